@@ -10,14 +10,14 @@
 // -----------------------------------------------------------------------------
 
 #include <atomic>
-#include <chrono>
 #include <csignal>
-#include <cstddef>
+#include <cstdint>
+#include <filesystem>
 #include <iostream>
-#include <thread>
 
 #include "Coordinates/WorldCoordinates.h"
 #include "Engine/Engine.h"
+#include "Engine/TelemetryWriter.h"
 #include "Math/Vector.h"
 #include "Particle/Particle.h"
 
@@ -36,7 +36,7 @@ void signal_handler(int signal) {
 }
 }  // namespace globals
 
-int main() {
+int main(int argc, char* argv[]) {
     // Register the signal handler
     std::signal(SIGINT, globals::signal_handler);
 
@@ -73,26 +73,33 @@ int main() {
     // Setup signal handler loop
     std::cout << "Running simulation loop. Press Ctrl+C to stop..." << "\n";
 
-    int step = 1;
     const double time_step = 0.1;
-
-    while (globals::g_running) {
-        std::cout << "\n--- Step " << step << " ---" << "\n";
-        engine.UpdateParticles(time_step);
-
-        // Print positions
-        auto& particles = engine.GetParticles();
-        for (std::size_t i = 0; i < particles.size(); ++i) {
-            auto pos = particles.at(i).GetPosition();
-            std::cout << "Particle " << i << " Position: (" << pos.GetX()
-                      << ", " << pos.GetY() << ", " << pos.GetZ() << ")"
-                      << "\n";
-        }
-
-        step++;
-        std::this_thread::sleep_for(std::chrono::milliseconds(sleep_time_ms));
-    }
-
-    std::cout << "\nSimulation stopped gracefully." << "\n";
+    constexpr double demo_duration = 3600.0;
+
+    // Positions of every step go to a CSV file, formatted and written on
+    // the telemetry thread rather than the simulation loop.
+    const std::filesystem::path telemetry_path =
+        argc > 1 ? argv[1] : "telemetry.csv";
+    solo::engine::TelemetrySettings telemetry_settings;
+    telemetry_settings.format = solo::engine::TelemetryFormat::Csv;
+    solo::engine::TelemetryWriter telemetry(telemetry_path,
+                                            telemetry_settings);
+    engine.AddObserver(telemetry.GetObserver());
+    std::cout << "Writing positions to " << telemetry_path.string() << "\n";
+
+    // One step per second of wall-clock time.
+    solo::engine::RunOptions options;
+    options.time_scale = time_step * 1000.0 / sleep_time_ms;
+    options.on_tick = [](std::uint64_t /*step*/, double /*time*/) {
+        return globals::g_running.load();
+    };
+    const std::uint64_t steps =
+        engine.RunFor(demo_duration, time_step, options);
+    telemetry.Close();
+
+    std::cout << "\nSimulation stopped gracefully after " << steps
+              << " steps; " << telemetry.GetRecordedTicks()
+              << " written, " << telemetry.GetDroppedTicks() << " dropped."
+              << "\n";
     return 0;
 }
@@ -35,6 +35,9 @@ macro(AddTests target)
 	target_link_libraries(${target} PRIVATE
     solo_engine::Math
 	solo_engine::Coordinates
+	solo_engine::Particle
+	solo_engine::Physics
+	solo_engine::Threading
 	solo_engine::Engine
 	solo_engine::AIS
     gtest
@@ -12,6 +12,7 @@
 #ifndef SOLO_AIS_MESSAGES_BASE_MESSAGE_H
 #define SOLO_AIS_MESSAGES_BASE_MESSAGE_H
 
+#include <memory_resource>
 #include <string>
 
 namespace solo {
@@ -32,7 +33,10 @@ public:
     BaseMessage& operator=(BaseMessage&&) = delete;
 
     virtual void Print() const = 0;
-    virtual std::string Encode() const = 0;
+    /// @brief Encodes the message into a string allocated from the given
+    /// resource, so encoding every tick can draw on a tick arena
+    virtual std::pmr::string Encode(
+        std::pmr::memory_resource* resource) const = 0;
     virtual void Decode(const std::string& payload) = 0;
 };
 
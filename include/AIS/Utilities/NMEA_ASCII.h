@@ -13,23 +13,28 @@
 #define SOLO_AIS_UTILITIES_NMEA_ASCII_H
 
 #include <bitset>
+#include <cstddef>
+#include <memory_resource>
 #include <string>
 
 namespace solo {
 namespace ais {
 namespace utilities {
 
-template <std::size_t N>
-std::string ToNmeaAscii(const std::bitset<N>& bits) {
+/// @brief Appends the six-bit ASCII armouring of a bit field to a string,
+/// most significant bit first. The last character is padded with zeros.
+/// @param bits Bit field to armour
+/// @param result String of any allocator to append to
+template <std::size_t N, typename String>
+void AppendNmeaAscii(const std::bitset<N>& bits, String& result) {
     constexpr std::size_t bits_per_char = 6;
     constexpr std::size_t rounding_offset = bits_per_char - 1;
     constexpr unsigned char ascii_offset_lower = 48;
     constexpr unsigned char ascii_offset_upper = 56;
     constexpr unsigned char threshold = 40;
 
-    std::string result;
     std::size_t num_chars = (N + rounding_offset) / bits_per_char;
-    result.reserve(num_chars);
+    result.reserve(result.size() + num_chars);
 
     for (std::size_t i = 0; i < num_chars; ++i) {
         unsigned char val = 0;
@@ -51,7 +56,22 @@ std::string ToNmeaAscii(const std::bitset<N>& bits) {
         }
         result.push_back(static_cast<char>(val));
     }
+}
 
+template <std::size_t N>
+std::string ToNmeaAscii(const std::bitset<N>& bits) {
+    std::string result;
+    AppendNmeaAscii(bits, result);
+    return result;
+}
+
+/// @brief Armours a bit field into a string allocated from a resource,
+/// e.g. a per-tick arena when encoding messages every tick
+template <std::size_t N>
+std::pmr::string ToNmeaAscii(const std::bitset<N>& bits,
+                             std::pmr::memory_resource* resource) {
+    std::pmr::string result(resource);
+    AppendNmeaAscii(bits, result);
     return result;
 }
 
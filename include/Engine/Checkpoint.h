@@ -0,0 +1,99 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_ENGINE_CHECKPOINT_H
+#define SOLO_ENGINE_CHECKPOINT_H
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "Particle/ParticleHandle.h"
+#include "Particle/ParticleStore.h"
+#include "Physics/EmitterRegistry.h"
+
+namespace solo {
+namespace engine {
+
+/// @brief Simulation clock stored alongside the particle state.
+struct CheckpointClock {
+    std::uint64_t tick_count{0};
+    double simulation_time{0.0};
+};
+
+/// @brief World state stored alongside the particle state: when each rate
+/// group phase was last advanced and when each emitted particle expires.
+/// The rate groups and emitters themselves are settings of the world.
+struct CheckpointSchedule {
+    /// Simulated time the world has been stepped through
+    double world_time{0.0};
+    /// Divisor of each rate group
+    std::vector<std::uint32_t> divisors;
+    /// Particles assigned to each phase, for every rate group in turn
+    std::vector<std::uint64_t> phase_members;
+    /// Simulated time each phase was last advanced to
+    std::vector<double> group_times;
+    /// Particles that joined a phase since it was last advanced: the
+    /// store group, the particle and the time its state is at
+    std::vector<std::uint32_t> joiner_groups;
+    std::vector<physics::ParticleHandle> joiner_handles;
+    std::vector<double> joiner_times;
+    /// Clock of the emitter registry
+    double emitter_time{0.0};
+    /// Lifetimes of emitted particles not yet ended
+    std::vector<physics::EmitterRegistry::Expiry> expiries;
+};
+
+/// @brief Binary checkpoint image of a particle store.
+/// The file is a header and section table followed by one section per
+/// store column and schedule column, each starting on an ALIGNMENT
+/// boundary and holding the raw column bytes. Loading maps the file and
+/// copies each section straight into its column, so no per-particle
+/// decoding is done.
+class Checkpoint {
+   public:
+    /// @brief Format version written by Save() and accepted by Load()
+    static constexpr std::uint32_t VERSION{5};
+
+    /// @brief Alignment of every section within the file
+    static constexpr std::uint64_t ALIGNMENT{4096};
+
+    /// @brief Writes a checkpoint. The file is written beside path and
+    /// renamed over it once complete. Throws std::runtime_error on I/O
+    /// failure.
+    /// @param path Destination file
+    /// @param store Particles to save
+    /// @param clock Simulation clock to save
+    /// @param schedule World state to save
+    static void Save(const std::filesystem::path& path,
+                     const physics::ParticleStore& store,
+                     const CheckpointClock& clock,
+                     const CheckpointSchedule& schedule);
+
+    /// @brief Maps and validates a checkpoint, then replaces the store's
+    /// contents with it. Throws std::runtime_error if the file cannot be
+    /// read or fails validation; the store and schedule are left untouched
+    /// in that case.
+    /// @param path Checkpoint file
+    /// @param store Store to restore into
+    /// @param schedule Holds the divisors of the loading world's rate
+    /// groups, which must match the saved ones; receives the saved world
+    /// state
+    /// @return Simulation clock saved with the particles
+    static CheckpointClock Load(const std::filesystem::path& path,
+                                physics::ParticleStore& store,
+                                CheckpointSchedule& schedule);
+};
+
+}  // namespace engine
+}  // namespace solo
+
+#endif  // SOLO_ENGINE_CHECKPOINT_H
@@ -0,0 +1,62 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_ENGINE_COMMAND_H
+#define SOLO_ENGINE_COMMAND_H
+
+#include <cstdint>
+
+#include "Math/Vector.h"
+#include "Particle/Particle.h"
+#include "Particle/ParticleHandle.h"
+
+namespace solo {
+namespace engine {
+
+/// @brief Identifies a world of an Engine
+using WorldId = std::uint32_t;
+
+/// @brief Kind of mutation carried by a Command
+enum class CommandType : uint8_t {
+    AddParticle,
+    RemoveParticle,
+    SetVelocity,
+    SetAcceleration,
+    SetRateGroup,
+    MigrateParticle,
+    EmitBurst
+};
+
+/// @brief Deferred mutation of the particle set, queued by producer threads
+/// and applied by the simulation loop at the start of a tick.
+struct Command {
+    CommandType type{CommandType::AddParticle};
+    /// World the particle lives in
+    WorldId world{0};
+    /// Target particle; for AddParticle the handle reserved for it
+    physics::ParticleHandle handle;
+    /// Handle reserved in the destination world for MigrateParticle
+    physics::ParticleHandle target;
+    /// Particle to add for AddParticle
+    physics::Particle particle;
+    /// Velocity or acceleration for the set commands
+    math::Vector vector;
+    /// Rate group for SetRateGroup, destination world for MigrateParticle,
+    /// emitter for EmitBurst
+    std::uint32_t value{0};
+    /// Particles to spawn for EmitBurst
+    std::uint32_t count{0};
+};
+
+}  // namespace engine
+}  // namespace solo
+
+#endif  // SOLO_ENGINE_COMMAND_H
@@ -13,22 +13,147 @@
 #define SOLO_ENGINE_ENGINE_H
 
 #include <atomic>
+#include <barrier>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <thread>
 #include <vector>
 
+#include "Engine/Command.h"
+#include "Engine/FixedStepScheduler.h"
+#include "Engine/LatencyHistogram.h"
+#include "Engine/SnapshotBuffer.h"
+#include "Engine/TickArena.h"
+#include "Engine/TickObserver.h"
+#include "Engine/World.h"
 #include "Particle/Particle.h"
+#include "Particle/ParticleHandle.h"
+#include "Particle/ParticleStore.h"
+#include "Physics/BarnesHut.h"
+#include "Physics/BroadPhase.h"
+#include "Physics/EmitterRegistry.h"
+#include "Physics/ForceRegistry.h"
+#include "Physics/Integrators.h"
+#include "Physics/SpatialGrid.h"
+#include "Math/Vector.h"
+#include "Threading/MpscQueue.h"
+#include "Threading/ThreadPlacement.h"
+#include "Threading/ThreadPool.h"
 
 namespace solo {
 namespace engine {
 
+/**
+ * @brief Timing of the simulation loop, in nanoseconds.
+ */
+struct EngineStats {
+    /// Whole tick, from draining commands to publishing the snapshot
+    LatencySummary tick;
+    /// Applying queued commands
+    LatencySummary commands;
+    /// Force generators and gravity
+    LatencySummary forces;
+    /// Integrating the particle store
+    LatencySummary integrate;
+    /// Finding overlapping particle pairs
+    LatencySummary broad_phase;
+    /// Rebuilding the spatial index
+    LatencySummary spatial_index;
+    /// Publishing the snapshot
+    LatencySummary snapshot;
+    /// Calling the tick observers, on ticks that have any
+    LatencySummary observers;
+    /// Ticks that took longer than their time step
+    std::uint64_t overruns{0};
+    /// Threads whose requested placement could not be applied
+    std::uint64_t placement_failures{0};
+    /// Observer calls that took longer than their budget
+    std::uint64_t observer_overruns{0};
+    /// Pacing counters, including catch-up and dropped ticks
+    SchedulerStats scheduler;
+};
+
+/**
+ * @brief Threads of a running engine and where they are scheduled.
+ */
+struct StartOptions {
+    /// Threads used to update particles, including the loop thread. Zero
+    /// uses every hardware thread. Ignored with more than one world, where
+    /// each world gets a thread of its own.
+    std::size_t thread_count{1};
+    /// CPUs and real-time priority of the loop thread
+    threading::ThreadPlacement loop_thread;
+    /// Placement of each pool worker in turn, or of the thread stepping
+    /// each additional world; threads past the end are left unplaced
+    std::vector<threading::ThreadPlacement> worker_threads;
+    /// Rewrite the particle columns from the threads that update them
+    /// once they are placed, so on NUMA machines each thread's share of
+    /// the particles is allocated on its own node
+    bool first_touch{false};
+};
+
+/**
+ * @brief Options for Engine::RunFor().
+ */
+struct RunOptions {
+    /**
+     * @brief Receives the tick count and simulation time after every tick,
+     * on the thread running the batch. Returning false ends the run early.
+     */
+    using TickCallback = std::function<bool(std::uint64_t, double)>;
+
+    /// Simulated seconds per wall-clock second, e.g. 10 or 100; zero runs
+    /// the ticks back to back as fast as possible
+    double time_scale{0.0};
+    /// Threads and placement as for Engine::Start(); the loop thread
+    /// placement is applied to the thread calling RunFor() and kept
+    StartOptions threads;
+    /// Optional tick boundary callback
+    TickCallback on_tick;
+};
+
 /**
  * @brief Core engine class managing physical entities.
+ * The particles live in one or more independent worlds that are ticked
+ * together. The particle methods without a world argument address the
+ * default world, which every engine has.
  */
 class Engine {
    public:
-    Engine() = default;
+    /**
+     * @brief Receives the overlapping pairs found by a tick, on the
+     * simulation thread. The pairs are only valid during the call.
+     */
+    using CollisionCallback = World::CollisionCallback;
+
+    /**
+     * @brief Rate group every particle starts in, updated every tick.
+     */
+    static constexpr RateGroupId BASE_RATE_GROUP{World::BASE_RATE_GROUP};
+
+    /**
+     * @brief World created with the engine.
+     */
+    static constexpr WorldId DEFAULT_WORLD{0};
+
+    /**
+     * @brief Constructs an engine with its default world.
+     * @param integrator Integration scheme for the particle update.
+     * @param upstream Source of the engine's memory pool. Scratch memory
+     * the worlds need while stepping is pooled, so once a workload has
+     * settled the ticks stop allocating from the upstream.
+     */
+    explicit Engine(physics::IntegratorType integrator =
+                        physics::IntegratorType::SymplecticEuler,
+                    std::pmr::memory_resource* upstream =
+                        std::pmr::get_default_resource());
 
     /**
      * @brief Destructor ensures simulation loop is stopped.
@@ -38,54 +163,762 @@ class Engine {
     /**
      * @brief Starts the threaded simulation tick function.
      * @param tick_rate_hz Target frequency for updates.
+     * @param thread_count Threads used to update particles, including the
+     * loop thread. Zero uses every hardware thread. With more than one
+     * world each world is stepped on a thread of its own instead, and the
+     * count is ignored.
      */
-    void Start(double tick_rate_hz = 60.0);
+    void Start(double tick_rate_hz = 60.0, std::size_t thread_count = 1);
+
+    /**
+     * @brief Starts the simulation loop with pinned or real-time threads.
+     * Each thread applies its placement before the first tick; failures,
+     * e.g. for lack of permission, are counted in GetStats() and the
+     * thread runs unplaced.
+     * @param tick_rate_hz Target frequency for updates.
+     * @param options Thread count, placement and NUMA first touch.
+     */
+    void Start(double tick_rate_hz, const StartOptions& options);
 
     /**
      * @brief Stops the threaded simulation tick function.
+     * An exception from a stage or an observer ends the loop started by
+     * Start(): IsRunning() turns false and the exception is rethrown here
+     * once the engine is stopped. Start() and RunFor() throw
+     * std::logic_error until then.
      */
     void Stop();
 
     /**
-     * @brief Checks if the simulation loop is currently running.
+     * @brief Runs a batch of ticks on the calling thread and returns when
+     * it is done, for headless runs faster than real time. The loop of
+     * Start() is not used, so nothing waits on wall-clock deadlines unless
+     * a time scale is set. Commands from other threads are queued while
+     * the batch runs; Stop() must not be called during it. An exception
+     * from the callback, an observer or a stage ends the batch and leaves
+     * the engine stopped before it propagates.
+     * Throws std::logic_error while running.
+     * @param duration Simulated seconds to run, rounded to whole ticks.
+     * @param time_step Simulated seconds per tick.
+     * @param options Pacing, threads and tick callback.
+     * @return Number of ticks run.
+     */
+    std::uint64_t RunFor(double duration, double time_step,
+                         const RunOptions& options = {});
+
+    /**
+     * @brief Checks if the simulation loop or a batch is currently running.
      * @return True if running.
      */
     bool IsRunning() const;
 
+    /**
+     * @brief Real-time counters of the simulation loop scheduler.
+     * @return Ticks run, missed deadlines, catch-up and dropped ticks.
+     */
+    SchedulerStats GetSchedulerStats() const;
+
+    /**
+     * @brief Tick and phase latency percentiles plus real-time counters.
+     * Recording is always on; safe to call from any thread.
+     * @return Snapshot of the statistics gathered since construction.
+     */
+    EngineStats GetStats() const;
+
     /**
      * @brief Adds a particle to the engine's management.
+     * While the engine is running the particle is queued and added at the
+     * start of the next tick; safe to call from any thread.
+     * @param particle The particle to add.
+     * @return Handle identifying the particle until it is removed.
+     */
+    physics::ParticleHandle AddParticle(const physics::Particle& particle);
+
+    /**
+     * @brief Removes a particle, moving the last particle into its index.
+     * Queued while running, like AddParticle(). Stale handles are ignored.
+     * @param handle Particle to remove.
+     */
+    void RemoveParticle(physics::ParticleHandle handle);
+
+    /**
+     * @brief Sets the velocity of a particle.
+     * Queued while running, like AddParticle().
+     * @param handle Target particle.
+     * @param velocity New velocity.
+     */
+    void SetParticleVelocity(physics::ParticleHandle handle,
+                             const math::Vector& velocity);
+
+    /**
+     * @brief Sets the acceleration of a particle.
+     * Queued while running, like AddParticle().
+     * @param handle Target particle.
+     * @param acceleration New acceleration.
+     */
+    void SetParticleAcceleration(physics::ParticleHandle handle,
+                                 const math::Vector& acceleration);
+
+    /**
+     * @brief Adds a group of particles updated every divisor ticks, with a
+     * time step of divisor base steps. Members are spread evenly over the
+     * divisor phases, so each tick updates a similar share of the group.
+     * Throws std::logic_error while running.
+     * @param divisor Ticks between updates of a member; at least 1.
+     * @return Group id for SetParticleRateGroup().
+     */
+    RateGroupId AddRateGroup(std::uint32_t divisor);
+
+    /**
+     * @brief Adds a rate group to a world.
+     * Throws std::logic_error while running.
+     */
+    RateGroupId AddRateGroup(WorldId world, std::uint32_t divisor);
+
+    /**
+     * @brief Moves a particle to a rate group.
+     * Queued while running, like AddParticle().
+     * @param handle Target particle.
+     * @param group Id from AddRateGroup(), or BASE_RATE_GROUP.
+     */
+    void SetParticleRateGroup(physics::ParticleHandle handle,
+                              RateGroupId group);
+
+    /**
+     * @brief Adds an empty world, stepped every tick alongside the others.
+     * Worlds share nothing but the clock, so each can be updated on its
+     * own core. Configure it through the WorldId overloads of the stage
+     * setters before starting.
+     * Must be called while the engine is stopped.
+     * @param integrator Integration scheme for the new world.
+     * @return Id of the world for the world overloads below.
+     */
+    WorldId AddWorld(physics::IntegratorType integrator =
+                         physics::IntegratorType::SymplecticEuler);
+
+    /**
+     * @brief Number of worlds, including the default world.
+     * @return World count.
+     */
+    std::size_t GetWorldCount() const;
+
+    /**
+     * @brief Access to a world's stages and particles. Not synchronised
+     * with the simulation loop, like GetParticles(); its setters do not
+     * check whether the engine runs, so prefer the engine's WorldId
+     * overloads.
+     * @param world Id from AddWorld(), or DEFAULT_WORLD.
+     * @return World; throws std::out_of_range for unknown ids, as do the
+     * world overloads below.
+     */
+    World& GetWorld(WorldId world);
+
+    /**
+     * @brief Read-only access to a world.
+     * @param world Id from AddWorld(), or DEFAULT_WORLD.
+     * @return World; throws std::out_of_range for unknown ids.
+     */
+    const World& GetWorld(WorldId world) const;
+
+    /**
+     * @brief Adds a particle to a world. Handles are only meaningful in
+     * the world that issued them.
+     * Queued while running, like AddParticle().
+     * @param world Destination world.
      * @param particle The particle to add.
+     * @return Handle identifying the particle within the world.
+     */
+    physics::ParticleHandle AddParticle(WorldId world,
+                                        const physics::Particle& particle);
+
+    /**
+     * @brief Removes a particle from a world.
+     * Queued while running, like AddParticle().
+     */
+    void RemoveParticle(WorldId world, physics::ParticleHandle handle);
+
+    /**
+     * @brief Sets the velocity of a particle in a world.
+     * Queued while running, like AddParticle().
+     */
+    void SetParticleVelocity(WorldId world, physics::ParticleHandle handle,
+                             const math::Vector& velocity);
+
+    /**
+     * @brief Sets the acceleration of a particle in a world.
+     * Queued while running, like AddParticle().
+     */
+    void SetParticleAcceleration(WorldId world,
+                                 physics::ParticleHandle handle,
+                                 const math::Vector& acceleration);
+
+    /**
+     * @brief Moves a particle to a rate group of its world.
+     * Queued while running, like AddParticle().
      */
-    void AddParticle(const physics::Particle& particle);
+    void SetParticleRateGroup(WorldId world, physics::ParticleHandle handle,
+                              RateGroupId group);
+
+    /**
+     * @brief Moves a particle to another world at the next tick boundary.
+     * Its state is carried over; it joins the base rate group of the
+     * destination and restarts any integrator history.
+     * Queued while running, like AddParticle(). Stale handles are ignored.
+     * @param from World the particle is in.
+     * @param handle Particle to move.
+     * @param to Destination world.
+     * @return Handle of the particle in the destination world. It never
+     * becomes valid if the migration is dropped for a stale handle.
+     */
+    physics::ParticleHandle MigrateParticle(WorldId from,
+                                            physics::ParticleHandle handle,
+                                            WorldId to);
 
     /**
      * @brief Calls update on a provided number of particles.
+     * While the engine is started the particle range is split into chunks
+     * across the worker pool, or each world is stepped on its own thread,
+     * and the call returns once every world is done.
      * @param time_step Delta time for the physical update.
      */
     void UpdateParticles(double time_step);
 
+    /**
+     * @brief Selects the integration scheme. Each scheme is a separate
+     * instantiation of the update kernel, so the per-particle loop has no
+     * branch on it. Throws std::logic_error while running.
+     * @param integrator Scheme for subsequent ticks.
+     */
+    void SetIntegrator(physics::IntegratorType integrator);
+
+    /**
+     * @brief Selects a world's integration scheme.
+     * Throws std::logic_error while running.
+     */
+    void SetIntegrator(WorldId world, physics::IntegratorType integrator);
+
+    /**
+     * @brief Integration scheme in use.
+     * @return Scheme selected at construction or by SetIntegrator().
+     */
+    physics::IntegratorType GetIntegrator() const;
+
+    /**
+     * @brief Integrates the default world in float local frames: each
+     * position is a float offset from the double origin of the region it
+     * lies in, and particles are rebased onto a new region as they leave
+     * one. The update kernel then runs on floats alone, at twice the SIMD
+     * width of the double positions, while positions keep their precision
+     * at Earth scale. The double position columns are refreshed when a
+     * stage, observer or snapshot reads them and whenever the engine
+     * stops, so GetParticles() is current between runs; write positions
+     * through ParticleRef::SetPosition() rather than the columns.
+     * Throws std::logic_error while running.
+     * @param region_size Edge of a region in metres; smaller regions keep
+     * more precision and rebase more often.
+     */
+    void EnableLocalFrames(
+        double region_size = physics::ParticleStore::DEFAULT_REGION_SIZE);
+
+    /**
+     * @brief Integrates a world in float local frames.
+     * Throws std::logic_error while running.
+     */
+    void EnableLocalFrames(WorldId world, double region_size);
+
+    /**
+     * @brief Moves the default world's particles in closed form instead of
+     * integrating them: each keeps its state as of the last time it was
+     * changed, and its accelerations are taken as constant since then, so
+     * its position at any time is a formula rather than a sum of steps. A
+     * tick then costs the commands it applies rather than a pass over
+     * every particle. The columns are refreshed as with local frames, so
+     * snapshots and observers still pay for a pass when enabled. Suits
+     * worlds without gravity or force generators, and cannot be combined
+     * with local frames.
+     * Throws std::logic_error while running, or if the world has force
+     * stages or local frames.
+     */
+    void EnableClosedFormMotion();
+
+    /**
+     * @brief Moves a world's particles in closed form.
+     * Throws std::logic_error while running, or if the world has force
+     * stages or local frames.
+     */
+    void EnableClosedFormMotion(WorldId world);
+
+    /**
+     * @brief Stops integrating particles that have come to rest. Sleeping
+     * particles keep their place in the spatial index, broad phase and
+     * snapshots, and wake on a SetParticleVelocity() or
+     * SetParticleAcceleration() call, or when a force generator that
+     * targets them is added or removed. Gravity acts on every particle, so
+     * nothing falls asleep while it is enabled.
+     * Throws std::logic_error while running.
+     * @param settings Thresholds and the number of quiet ticks.
+     */
+    void EnableSleeping(const SleepSettings& settings = {});
+
+    /**
+     * @brief Puts a world's resting particles to sleep.
+     * Throws std::logic_error while running.
+     */
+    void EnableSleeping(WorldId world, const SleepSettings& settings);
+
+    /**
+     * @brief Number of particles integrated each tick.
+     * @return Particles not asleep.
+     */
+    std::size_t GetAwakeParticleCount() const;
+
     /**
      * @brief Returns the total number of particles currently in the engine.
      * @return Number of particles.
      */
     std::size_t GetParticleCount() const;
 
+    /**
+     * @brief Number of ticks completed since construction.
+     * @return Tick count, safe to read from any thread.
+     */
+    std::uint64_t GetTickCount() const;
+
+    /**
+     * @brief Simulated time accumulated over every completed tick.
+     * @return Simulation time in seconds, safe to read from any thread.
+     */
+    double GetSimulationTime() const;
+
+    /**
+     * @brief Publishes a snapshot of the default world after every tick.
+     * Throws std::logic_error while running.
+     * @param slot_count Snapshot slots; allows slot_count - 2 readers to
+     * hold a snapshot at once without the engine skipping a publish.
+     */
+    void EnableSnapshots(std::size_t slot_count = 3);
+
+    /**
+     * @brief Pins the snapshot published after the most recent tick.
+     * Lock-free and safe to call from any thread while the engine runs.
+     * @return Pinned snapshot, empty before the first publish or when
+     * snapshots are not enabled.
+     */
+    PinnedSnapshot AcquireSnapshot() const;
+
+    /**
+     * @brief Adds mutual gravity between particles, evaluated with a
+     * Barnes-Hut octree before integration every tick. The resulting
+     * acceleration is added to each particle's own acceleration for the
+     * tick; the stored acceleration is left unchanged.
+     * Throws std::logic_error while running.
+     * @param settings Opening angle, gravitational constant and softening.
+     */
+    void EnableGravity(const physics::BarnesHutSettings& settings = {});
+
+    /**
+     * @brief Adds mutual gravity between the particles of a world.
+     * Throws std::logic_error while running.
+     */
+    void EnableGravity(WorldId world,
+                       const physics::BarnesHutSettings& settings);
+
+    /**
+     * @brief Registers an environmental force such as uniform gravity,
+     * drag, wind or current. Every generator is evaluated in one fused
+     * sweep over the particles before integration; like gravity, the
+     * result is added to each particle's acceleration for the tick only.
+     * Throws std::logic_error while running.
+     * @param generator Force and the particle tags it targets.
+     * @return Id for RemoveForceGenerator().
+     */
+    physics::ForceGeneratorId AddForceGenerator(
+        const physics::ForceGenerator& generator);
+
+    /**
+     * @brief Unregisters a force generator from a world.
+     * Throws std::logic_error while running.
+     */
+    bool RemoveForceGenerator(WorldId world, physics::ForceGeneratorId id);
+
+    /**
+     * @brief Registers a force generator with a world.
+     * Throws std::logic_error while running.
+     */
+    physics::ForceGeneratorId AddForceGenerator(
+        WorldId world, const physics::ForceGenerator& generator);
+
+    /**
+     * @brief Unregisters a force generator.
+     * Throws std::logic_error while running.
+     * @param id Id returned by AddForceGenerator().
+     * @return False if no generator has the id.
+     */
+    bool RemoveForceGenerator(physics::ForceGeneratorId id);
+
+    /**
+     * @brief Registers a particle emitter with the default world. Its
+     * particles are spawned in one batch per tick and removed once their
+     * lifetime ends, without going through the command queue; room for
+     * them is reserved up front.
+     * Throws std::logic_error while running.
+     * @param emitter Spawn region, spreads, rate, lifetime and capacity.
+     * @return Id for RemoveEmitter() and EmitBurst().
+     */
+    physics::EmitterId AddEmitter(const physics::Emitter& emitter);
+
+    /**
+     * @brief Spawns a batch from one of a world's emitters at the next
+     * tick. Queued while running, like AddParticle().
+     */
+    void EmitBurst(WorldId world, physics::EmitterId id, std::uint32_t count);
+
+    /**
+     * @brief Unregisters an emitter from a world.
+     * Throws std::logic_error while running.
+     */
+    bool RemoveEmitter(WorldId world, physics::EmitterId id);
+
+    /**
+     * @brief Registers a particle emitter with a world.
+     * Throws std::logic_error while running.
+     */
+    physics::EmitterId AddEmitter(WorldId world,
+                                  const physics::Emitter& emitter);
+
+    /**
+     * @brief Unregisters an emitter; its particles live out their
+     * lifetimes.
+     * Throws std::logic_error while running.
+     * @param id Id returned by AddEmitter().
+     * @return False if no emitter has the id.
+     */
+    bool RemoveEmitter(physics::EmitterId id);
+
+    /**
+     * @brief Spawns a batch of particles from an emitter at the next tick.
+     * Queued while running, like AddParticle(). Unknown ids are ignored.
+     * @param id Id returned by AddEmitter().
+     * @param count Particles to spawn.
+     */
+    void EmitBurst(physics::EmitterId id, std::uint32_t count);
+
+    /**
+     * @brief Runs a broad-phase collision stage after integration every
+     * tick, finding each pair of particles whose radius spheres overlap.
+     * Throws std::logic_error while running.
+     * @param callback Optional receiver of each tick's pairs.
+     */
+    void EnableBroadPhase(CollisionCallback callback = {});
+
+    /**
+     * @brief Runs the broad-phase collision stage in a world.
+     * Throws std::logic_error while running.
+     */
+    void EnableBroadPhase(WorldId world, CollisionCallback callback);
+
+    /**
+     * @brief Pairs found by the most recent tick's broad phase.
+     * Not synchronised with the simulation loop, like GetParticles().
+     * @return Overlapping pairs, empty when the stage is not enabled.
+     */
+    const std::vector<physics::CollisionPair>& GetCollisionPairs() const;
+
+    /**
+     * @brief Maintains a spatial index over particle positions, rebuilt at
+     * the end of every tick. Throws std::logic_error while running.
+     * @param cell_size Edge length of a grid cell, about the typical query
+     * radius; positive and finite.
+     */
+    void EnableSpatialIndex(double cell_size);
+
+    /**
+     * @brief Maintains a spatial index over the particles of a world.
+     * Throws std::logic_error while running.
+     */
+    void EnableSpatialIndex(WorldId world, double cell_size);
+
+    /**
+     * @brief Sorts the particles by the Morton code of their position every
+     * few ticks, so particles close in space sit close in memory for the
+     * spatial stages. Handles stay valid across the sort; dense indices do
+     * not. Throws std::logic_error while running.
+     * @param cadence Ticks between sorts; at least 1.
+     */
+    void EnableMortonOrder(std::uint32_t cadence);
+
+    /**
+     * @brief Sorts a world's particles by Morton code every few ticks.
+     * Throws std::logic_error while running.
+     */
+    void EnableMortonOrder(WorldId world, std::uint32_t cadence);
+
+    /**
+     * @brief Spatial index built at the end of the most recent tick.
+     * Results are dense indices into GetParticles() as of that tick. Not
+     * synchronised with the simulation loop, like GetParticles().
+     * @return Grid, or nullptr when the index is not enabled.
+     */
+    const physics::SpatialGrid* GetSpatialIndex() const;
+
+    /**
+     * @brief Registers an observer called after every tick, once the
+     * worlds have stepped and before the snapshot is published. Observers
+     * finish before the next tick starts, so they may read their world
+     * without racing the loop. Must be called while the engine is stopped.
+     * @param observer Function, context, world and budget of the observer.
+     * @return Id for RemoveObserver() and GetObserverOverruns().
+     */
+    ObserverId AddObserver(const TickObserver& observer);
+
+    /**
+     * @brief Unregisters an observer.
+     * Must be called while the engine is stopped.
+     * @param id Id returned by AddObserver().
+     * @return False if no observer has the id.
+     */
+    bool RemoveObserver(ObserverId id);
+
+    /**
+     * @brief Number of calls to an observer that exceeded its budget.
+     * @param id Id returned by AddObserver().
+     */
+    std::uint64_t GetObserverOverruns(ObserverId id) const;
+
+    /**
+     * @brief Thread-safe pooled resource for memory that outlives a tick,
+     * such as buffers kept by observers or force generators.
+     */
+    std::pmr::memory_resource* GetMemoryPool() { return &mPool; }
+
+    /**
+     * @brief Scratch memory rewound at the start of every tick. Only for
+     * the thread running the ticks, e.g. from loop observers.
+     */
+    std::pmr::memory_resource* GetTickArena() {
+        return mTickArena.GetResource();
+    }
+
+    /**
+     * @brief Writes the default world's store and the clock to a binary
+     * checkpoint, with the rate group timing and the lifetimes of emitted
+     * particles. Must be called while the engine is stopped, and throws
+     * std::logic_error if the engine has more than one world.
+     * @param path Destination file, replaced once the write completes.
+     */
+    void SaveCheckpoint(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Replaces the default world's store and the clock with a
+     * checkpoint written by SaveCheckpoint(). Handles saved with the
+     * checkpoint stay valid, and particles keep their rate group, sleep
+     * state and lifetime. Must be called while the engine is stopped, and
+     * throws std::logic_error if the engine has more than one world.
+     * @param path Checkpoint file; the engine is unchanged if it is invalid
+     * or was saved with different rate groups.
+     */
+    void LoadCheckpoint(const std::filesystem::path& path);
+
     /**
      * @brief Allows access to the underlying particle collection.
-     * @return Reference to the vector of particles.
+     * Not synchronised with the simulation loop; readers on other threads
+     * should use AcquireSnapshot() while the engine is running.
+     * @return Reference to the structure-of-arrays particle store.
      */
-    std::vector<physics::Particle>& GetParticles();
+    physics::ParticleStore& GetParticles();
+
+    /**
+     * @brief Read-only access to the underlying particle collection.
+     * @return Const reference to the structure-of-arrays particle store.
+     */
+    const physics::ParticleStore& GetParticles() const;
 
    private:
+    static constexpr std::size_t COMMAND_QUEUE_CAPACITY{16384};
+
     /**
      * @brief Internal loop managed by the thread.
+     * Ticks are paced to absolute deadlines; missed deadlines are recovered
+     * with back to back catch-up ticks up to the scheduler limit.
      * @param tick_rate_hz Frequency of updates.
+     * @param placement Placement of the loop thread.
+     * @param first_touch Whether to first-touch the default world.
+     */
+    void SimulationLoop(double tick_rate_hz,
+                        const threading::ThreadPlacement& placement,
+                        bool first_touch);
+
+    /**
+     * @brief Queues a command while a loop may be live, otherwise applies
+     * it directly. Producers spin on a full queue; the simulation loop
+     * never waits.
+     * @param command Mutation to apply.
+     */
+    void Submit(const Command& command);
+
+    /**
+     * @brief Sends commands to the queue from here on. Called before a
+     * loop starts; waits out any command being applied directly.
+     */
+    void LeaveIdle();
+
+    /**
+     * @brief Applies commands directly from here on. Called once the loop
+     * and its workers are gone; drains everything queued meanwhile.
+     */
+    void EnterIdle();
+
+    /**
+     * @brief Applies a single command to the particle store.
+     * @param command Mutation to apply.
+     */
+    void ApplyCommand(const Command& command);
+
+    /**
+     * @brief Drains the command queue and applies it as one batch.
+     */
+    void ApplyCommands();
+
+    /**
+     * @brief Throws std::out_of_range unless the world exists.
+     */
+    void CheckWorld(WorldId world) const;
+
+    /**
+     * @brief Steps every world once, in parallel when the world threads
+     * are running, and records the slowest world's stage times.
+     * @param time_step Base time step.
+     */
+    void StepWorlds(double time_step);
+
+    /**
+     * @brief Brings the position columns of every world up to date with
+     * its local frames.
+     */
+    void SyncPositions();
+
+    /**
+     * @brief Loop of the thread stepping one of the additional worlds in
+     * lockstep with the simulation loop.
+     * @param world World to step.
+     * @param placement Placement of the thread.
+     * @param first_touch Whether to first-touch the world.
+     */
+    void WorldLoop(WorldId world, const threading::ThreadPlacement& placement,
+                   bool first_touch);
+
+    /**
+     * @brief Places the thread about to run the default world and, if
+     * asked, moves that world's pages next to its threads.
+     */
+    void PrepareLoopThread(const threading::ThreadPlacement& placement,
+                           bool first_touch);
+
+    /**
+     * @brief Applies a placement to the calling thread, counting failures.
+     */
+    void PlaceThread(const threading::ThreadPlacement& placement);
+
+    /**
+     * @brief Creates the pool, or one thread per additional world.
+     * @param options Thread count and placement, as for Start().
+     */
+    void StartWorkers(const StartOptions& options);
+
+    /**
+     * @brief Destroys the pool, or lets the world threads leave
+     * WorldLoop() and joins them.
+     */
+    void StopWorkers();
+
+    /**
+     * @brief The world addressed by the overloads without a world id.
+     */
+    World& DefaultWorld() { return *mWorlds[DEFAULT_WORLD]; }
+    const World& DefaultWorld() const { return *mWorlds[DEFAULT_WORLD]; }
+
+    /**
+     * @brief Copies the particle state into the next snapshot slot.
+     */
+    void PublishSnapshot();
+
+    /**
+     * @brief Registered observer and the calls that overran its budget.
+     */
+    struct ObserverEntry {
+        TickObserver observer;
+        ObserverId id{0};
+        std::atomic<std::uint64_t> overruns{0};
+    };
+
+    /**
+     * @brief Calls the worker observers across the pool, then the loop
+     * observers in order.
+     */
+    void NotifyObservers();
+
+    /**
+     * @brief Calls one observer and checks it against its budget.
+     * @param memory Scratch memory handed to the observer.
+     */
+    void CallObserver(ObserverEntry& entry, std::pmr::memory_resource* memory);
+
+    /**
+     * @brief Finds a registered observer, or returns nullptr.
      */
-    void SimulationLoop(double tick_rate_hz);
+    const ObserverEntry* FindObserver(ObserverId id) const;
 
-    std::vector<physics::Particle> mParticles;
+    /// Long-lived and cross-thread scratch memory; declared first so it
+    /// outlives everything allocated from it
+    std::pmr::synchronized_pool_resource mPool;
+    TickArena mTickArena;
+    /// Worlds by id; the default world comes first
+    std::vector<std::unique_ptr<World>> mWorlds;
+    threading::MpscQueue<Command> mCommands{COMMAND_QUEUE_CAPACITY};
+    std::unique_ptr<threading::ThreadPool> mThreadPool;
+    FixedStepScheduler mScheduler;
+    std::unique_ptr<SnapshotBuffer> mSnapshots;
+    LatencyHistogram mTickTimes;
+    LatencyHistogram mCommandTimes;
+    LatencyHistogram mForceTimes;
+    LatencyHistogram mIntegrateTimes;
+    LatencyHistogram mBroadPhaseTimes;
+    LatencyHistogram mSpatialIndexTimes;
+    LatencyHistogram mSnapshotTimes;
+    LatencyHistogram mObserverTimes;
+    std::atomic<std::uint64_t> mOverruns{0};
+    std::atomic<std::uint64_t> mPlacementFailures{0};
+    std::atomic<std::uint64_t> mObserverOverruns{0};
+    std::atomic<std::uint64_t> mTickCount{0};
+    std::atomic<double> mSimulationTime{0.0};
     std::atomic<bool> mRunning{false};
+    /// Exception that ended the loop thread, rethrown by Stop()
+    std::exception_ptr mLoopFailure;
+    /// No loop thread or batch run can be touching the worlds; unlike
+    /// mRunning, only set once they are torn down
+    std::atomic<bool> mLoopIdle{true};
+    /// Producers between reading mLoopIdle and finishing their push
+    std::atomic<std::size_t> mPendingPushes{0};
+    /// Held while applying a command directly and while mLoopIdle changes
+    std::mutex mIdleMutex;
     std::thread mLoopThread;
+    /// Threads stepping worlds 1 and up, in lockstep with the loop thread
+    std::vector<std::thread> mWorldThreads;
+    /// Releases the world threads into a step
+    std::unique_ptr<std::barrier<>> mStepStart;
+    /// Joins the world threads once every world has stepped
+    std::unique_ptr<std::barrier<>> mStepDone;
+    /// Tells the released world threads to return instead of stepping
+    std::atomic<bool> mWorldsStopping{false};
+    double mWorldTimeStep{0.0};
+    /// Exception thrown by each world thread in the current step, indexed
+    /// by world; rethrown by the loop thread once the step has joined
+    std::vector<std::exception_ptr> mWorldFailures;
+    /// Observers called on the loop thread, in registration order
+    std::vector<std::unique_ptr<ObserverEntry>> mLoopObservers;
+    /// Observers spread over the pool
+    std::vector<std::unique_ptr<ObserverEntry>> mWorkerObservers;
+    ObserverId mNextObserverId{0};
 };
 
 }  // namespace engine
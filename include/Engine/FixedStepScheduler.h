@@ -0,0 +1,95 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_ENGINE_FIXED_STEP_SCHEDULER_H
+#define SOLO_ENGINE_FIXED_STEP_SCHEDULER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace solo {
+namespace engine {
+
+/// @brief Counters describing how well the scheduler kept real time.
+struct SchedulerStats {
+    /// Ticks released by the scheduler, including catch-up ticks
+    std::uint64_t ticks{0};
+    /// Deadlines that had already passed when the previous tick finished
+    std::uint64_t missed_deadlines{0};
+    /// Extra ticks run back to back to recover missed deadlines
+    std::uint64_t catch_up_ticks{0};
+    /// Missed deadlines abandoned because they exceeded the catch-up limit
+    std::uint64_t dropped_ticks{0};
+};
+
+/// @brief Paces a fixed timestep loop against absolute deadlines.
+/// Deadline k is epoch + k * interval, computed from the tick index rather
+/// than accumulated, so oversleeping or a slow tick never shifts the
+/// schedule. Waiting sleeps until shortly before the deadline and spins for
+/// the remainder to keep wake-up jitter low.
+class FixedStepScheduler {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Constructs a scheduler
+    /// @param max_catch_up_ticks Most ticks released by a single Advance()
+    /// @param spin_window Portion of each wait spent spinning instead of
+    /// sleeping
+    explicit FixedStepScheduler(
+        std::size_t max_catch_up_ticks = 5,
+        Clock::duration spin_window = std::chrono::microseconds(500));
+
+    /// @brief Restarts the schedule with the first deadline at start
+    /// @param tick_rate_hz Target tick frequency
+    /// @param start Time of the first deadline
+    void Reset(double tick_rate_hz, Clock::time_point start);
+
+    /// @brief Blocks until the next deadline using a sleep then spin wait
+    void WaitForNextDeadline() const;
+
+    /// @brief Consumes every deadline at or before now
+    /// @param now Current time
+    /// @return Number of ticks to run, at most the catch-up limit
+    std::size_t Advance(Clock::time_point now);
+
+    /// @brief Absolute time of the next unconsumed deadline
+    Clock::time_point GetNextDeadline() const;
+
+    /// @brief Fixed simulation timestep in seconds
+    double GetTimeStep() const { return mTimeStep; }
+
+    /// @brief Snapshot of the real-time counters. Safe to call from any
+    /// thread.
+    SchedulerStats GetStats() const;
+
+   private:
+    Clock::time_point DeadlineAt(std::uint64_t tick_index) const;
+
+    std::size_t mMaxCatchUpTicks;
+    Clock::duration mSpinWindow;
+
+    double mTimeStep{0.0};
+    std::chrono::duration<double> mInterval{0.0};
+    Clock::time_point mEpoch;
+    std::uint64_t mNextTickIndex{0};
+
+    std::atomic<std::uint64_t> mTicks{0};
+    std::atomic<std::uint64_t> mMissedDeadlines{0};
+    std::atomic<std::uint64_t> mCatchUpTicks{0};
+    std::atomic<std::uint64_t> mDroppedTicks{0};
+};
+
+}  // namespace engine
+}  // namespace solo
+
+#endif  // SOLO_ENGINE_FIXED_STEP_SCHEDULER_H
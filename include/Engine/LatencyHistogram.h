@@ -0,0 +1,106 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_ENGINE_LATENCY_HISTOGRAM_H
+#define SOLO_ENGINE_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace solo {
+namespace engine {
+
+/// @brief Percentiles of a recorded latency distribution, in nanoseconds.
+struct LatencySummary {
+    std::uint64_t count{0};
+    std::uint64_t mean{0};
+    std::uint64_t p50{0};
+    std::uint64_t p99{0};
+    std::uint64_t p999{0};
+    std::uint64_t max{0};
+};
+
+/// @brief Fixed-memory HDR-style histogram of durations in nanoseconds.
+/// Values are bucketed log-linearly: each power of two range is split into
+/// SUB_BUCKET_HALF linear sub-buckets, so every recorded value is resolved
+/// to within 1/64 (about 1.6%) of itself across the whole 64-bit range.
+/// Record() is a handful of bit operations and relaxed stores made by a
+/// single writer thread; Summarize() may be called from any thread.
+class LatencyHistogram {
+   public:
+    LatencyHistogram() = default;
+
+    // Prevent copy and assignment
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    // Prevent move and assignment
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+
+    /// @brief Records one value. Single writer thread only.
+    /// @param nanoseconds Duration to record
+    void Record(std::uint64_t nanoseconds) {
+        Increment(mCounts[BucketIndex(nanoseconds)], 1);
+        Increment(mCount, 1);
+        Increment(mSum, nanoseconds);
+        if (nanoseconds > mMax.load(std::memory_order_relaxed)) {
+            mMax.store(nanoseconds, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Computes the percentiles of everything recorded so far.
+    /// Safe to call from any thread while the writer records.
+    LatencySummary Summarize() const;
+
+    /// @brief Bucket a value falls into
+    static std::size_t BucketIndex(std::uint64_t value) {
+        if (value < SUB_BUCKET_COUNT) {
+            return static_cast<std::size_t>(value);
+        }
+        const auto shift = static_cast<std::size_t>(std::bit_width(value)) -
+                           SUB_BUCKET_BITS;
+        return shift * SUB_BUCKET_HALF +
+               static_cast<std::size_t>(value >> shift);
+    }
+
+    /// @brief Largest value that falls into a bucket
+    static std::uint64_t BucketUpperBound(std::size_t index);
+
+   private:
+    static constexpr std::size_t SUB_BUCKET_BITS{7};
+    static constexpr std::size_t SUB_BUCKET_COUNT{std::size_t{1}
+                                                  << SUB_BUCKET_BITS};
+    static constexpr std::size_t SUB_BUCKET_HALF{SUB_BUCKET_COUNT / 2};
+    static constexpr std::size_t BUCKET_COUNT{(64 - SUB_BUCKET_BITS + 1) *
+                                                  SUB_BUCKET_HALF +
+                                              SUB_BUCKET_HALF};
+
+    /// @brief Single-writer increment; avoids a locked read-modify-write.
+    static void Increment(std::atomic<std::uint64_t>& counter,
+                          std::uint64_t amount) {
+        counter.store(counter.load(std::memory_order_relaxed) + amount,
+                      std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> mCounts{};
+    std::atomic<std::uint64_t> mCount{0};
+    std::atomic<std::uint64_t> mSum{0};
+    std::atomic<std::uint64_t> mMax{0};
+};
+
+}  // namespace engine
+}  // namespace solo
+
+#endif  // SOLO_ENGINE_LATENCY_HISTOGRAM_H
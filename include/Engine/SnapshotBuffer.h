@@ -0,0 +1,162 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_ENGINE_SNAPSHOT_BUFFER_H
+#define SOLO_ENGINE_SNAPSHOT_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Particle/ParticleHandle.h"
+#include "Particle/ParticleStore.h"
+
+namespace solo {
+namespace engine {
+
+/// @brief Copy of the particle state taken at the end of a tick.
+class ParticleSnapshot {
+   public:
+    /// @brief Tick index the snapshot was taken after
+    std::uint64_t GetTick() const { return mTick; }
+
+    /// @brief Simulation time in seconds at the end of the tick
+    double GetSimulationTime() const { return mSimulationTime; }
+
+    /// @brief Number of particles captured
+    std::size_t size() const { return mPosition.x.size(); }
+
+    const std::vector<physics::ParticleHandle>& Handles() const {
+        return mHandles;
+    }
+    const physics::VectorColumns<double>& Position() const { return mPosition; }
+    const physics::VectorColumns<float>& Velocity() const { return mVelocity; }
+    const physics::VectorColumns<float>& Angle() const { return mAngle; }
+    const physics::VectorColumns<float>& AngularVelocity() const {
+        return mAngularVelocity;
+    }
+
+    /// @brief Sizes every column, reusing existing capacity
+    /// @param count Number of particles to capture
+    void Resize(std::size_t count);
+
+    /// @brief Copies the dense range [begin, end) from the store. Disjoint
+    /// ranges may be copied concurrently after Resize().
+    /// @param store Source store
+    /// @param begin First dense index
+    /// @param end One past the last dense index
+    void CopyRange(const physics::ParticleStore& store, std::size_t begin,
+                   std::size_t end);
+
+    /// @brief Stamps the snapshot with the tick it was taken after
+    void SetTick(std::uint64_t tick, double simulation_time);
+
+   private:
+    std::uint64_t mTick{0};
+    double mSimulationTime{0.0};
+
+    std::vector<physics::ParticleHandle> mHandles;
+    physics::VectorColumns<double> mPosition;
+    physics::VectorColumns<float> mVelocity;
+    physics::VectorColumns<float> mAngle;
+    physics::VectorColumns<float> mAngularVelocity;
+};
+
+/// @brief Reader side pin on a published snapshot.
+/// The snapshot cannot be overwritten while any pin on it is alive.
+class PinnedSnapshot {
+   public:
+    PinnedSnapshot() = default;
+    ~PinnedSnapshot();
+
+    // Prevent copy and assignment
+    PinnedSnapshot(const PinnedSnapshot&) = delete;
+    PinnedSnapshot& operator=(const PinnedSnapshot&) = delete;
+
+    PinnedSnapshot(PinnedSnapshot&& other) noexcept;
+    PinnedSnapshot& operator=(PinnedSnapshot&& other) noexcept;
+
+    /// @brief True when a snapshot is held
+    explicit operator bool() const { return mSnapshot != nullptr; }
+
+    const ParticleSnapshot& operator*() const { return *mSnapshot; }
+    const ParticleSnapshot* operator->() const { return mSnapshot; }
+
+   private:
+    friend class SnapshotBuffer;
+
+    PinnedSnapshot(std::atomic<std::int32_t>* pins,
+                   const ParticleSnapshot* snapshot);
+    void Release();
+
+    std::atomic<std::int32_t>* mPins{nullptr};
+    const ParticleSnapshot* mSnapshot{nullptr};
+};
+
+/// @brief Lock-free multi-slot buffer publishing snapshots from a single
+/// writer to any number of readers.
+/// Each slot carries a pin count. Readers pin the latest slot with a compare
+/// and swap, and the writer only ever claims a slot that is unpinned and not
+/// the latest, so neither side blocks. A buffer with N slots guarantees the
+/// writer a free slot while at most N - 2 readers hold pins; otherwise the
+/// publish is skipped rather than stalling the tick.
+class SnapshotBuffer {
+   public:
+    /// @brief Constructs the buffer
+    /// @param slot_count Number of snapshot slots, at least three
+    explicit SnapshotBuffer(std::size_t slot_count = 3);
+
+    // Prevent copy and assignment
+    SnapshotBuffer(const SnapshotBuffer&) = delete;
+    SnapshotBuffer& operator=(const SnapshotBuffer&) = delete;
+
+    // Prevent move and assignment
+    SnapshotBuffer(SnapshotBuffer&&) = delete;
+    SnapshotBuffer& operator=(SnapshotBuffer&&) = delete;
+
+    /// @brief Claims a slot for writing. Writer thread only.
+    /// @return Snapshot to fill, or nullptr when every free slot is pinned
+    ParticleSnapshot* BeginWrite();
+
+    /// @brief Publishes the slot claimed by BeginWrite(). Writer thread only.
+    void CommitWrite();
+
+    /// @brief Pins the most recently published snapshot. Any thread.
+    /// @return Pin on the snapshot, empty if nothing has been published
+    PinnedSnapshot Acquire() const;
+
+    /// @brief Number of publishes skipped because no slot was free
+    std::uint64_t GetSkippedWrites() const {
+        return mSkippedWrites.load(std::memory_order_relaxed);
+    }
+
+   private:
+    static constexpr std::int32_t WRITER_PIN{-1};
+    static constexpr std::size_t NO_SLOT{~std::size_t{0}};
+
+    struct alignas(64) Slot {
+        mutable std::atomic<std::int32_t> pins{0};
+        ParticleSnapshot snapshot;
+    };
+
+    std::size_t mSlotCount;
+    std::unique_ptr<Slot[]> mSlots;
+    std::atomic<std::size_t> mLatest{NO_SLOT};
+    std::size_t mWriting{NO_SLOT};
+    std::atomic<std::uint64_t> mSkippedWrites{0};
+};
+
+}  // namespace engine
+}  // namespace solo
+
+#endif  // SOLO_ENGINE_SNAPSHOT_BUFFER_H
@@ -0,0 +1,193 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_ENGINE_TELEMETRY_WRITER_H
+#define SOLO_ENGINE_TELEMETRY_WRITER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <thread>
+
+#include "Engine/TickObserver.h"
+#include "Particle/ParticleHandle.h"
+#include "Threading/SpscRing.h"
+
+namespace solo {
+namespace engine {
+
+/// @brief Layout of a telemetry file
+enum class TelemetryFormat : uint8_t {
+    /// TELEMETRY_MAGIC, then the records exactly as they pass through the
+    /// ring: a TelemetryTick per tick followed by a TelemetryParticle per
+    /// particle, in native byte order
+    Binary,
+    /// One line per particle per tick: tick,time,index,generation,x,y,z
+    Csv
+};
+
+/// @brief What recording a tick does when the ring has no room for it
+enum class TelemetryOverflow : uint8_t {
+    /// Skip the whole tick and count it; the loop never waits
+    Drop,
+    /// Wait for the writer to make room; no tick is lost
+    Block
+};
+
+/// @brief Settings of a TelemetryWriter
+struct TelemetrySettings {
+    TelemetryFormat format{TelemetryFormat::Binary};
+    TelemetryOverflow overflow{TelemetryOverflow::Drop};
+    /// Records the ring holds, rounded up to a power of two; the ring uses
+    /// 32 bytes per record and a tick takes one per particle plus one
+    std::size_t ring_capacity{std::size_t{1} << 20};
+    /// Bytes of CSV text gathered before each write to the file
+    std::size_t batch_bytes{std::size_t{1} << 20};
+};
+
+/// @brief Header of one tick in the telemetry stream, followed by one
+/// TelemetryParticle per particle
+struct TelemetryTick {
+    /// Ticks completed, counting this one
+    std::uint64_t tick{0};
+    double simulation_time{0.0};
+    std::uint64_t particle_count{0};
+    std::uint64_t reserved{0};
+};
+
+/// @brief State of one particle in the telemetry stream
+struct TelemetryParticle {
+    physics::ParticleHandle handle;
+    double x{0.0};
+    double y{0.0};
+    double z{0.0};
+};
+
+/// @brief Raw slot of the telemetry ring, holding either record type
+struct alignas(8) TelemetryRecord {
+    std::byte bytes[32];
+};
+
+static_assert(sizeof(TelemetryTick) == sizeof(TelemetryRecord) &&
+                  sizeof(TelemetryParticle) == sizeof(TelemetryRecord),
+              "Telemetry records share one slot size");
+
+/// @brief First bytes of a binary telemetry file
+inline constexpr char TELEMETRY_MAGIC[8] = {'S', 'O', 'L', 'O',
+                                            'T', 'L', 'M', '1'};
+
+/// @brief Streams the particle positions of every tick to a file without
+/// formatting or file I/O on the simulation thread. Record() copies a tick
+/// into a lock-free single-producer ring; a writer thread drains the ring
+/// in large batches, converting to CSV there when asked. Memory use is
+/// bounded by the ring and the CSV batch.
+class TelemetryWriter {
+   public:
+    /// @brief Opens the file and starts the writer thread
+    /// @param path Destination, replaced if it exists
+    /// @param settings Format, overflow policy and buffer sizes
+    /// @throws std::runtime_error if the file cannot be opened
+    explicit TelemetryWriter(const std::filesystem::path& path,
+                             const TelemetrySettings& settings = {});
+
+    /// @brief Writes everything recorded and closes the file. Lost
+    /// telemetry goes unreported; call Close() first to see it.
+    ~TelemetryWriter();
+
+    // Prevent copy and assignment
+    TelemetryWriter(const TelemetryWriter&) = delete;
+    TelemetryWriter& operator=(const TelemetryWriter&) = delete;
+
+    // Prevent move and assignment
+    TelemetryWriter(TelemetryWriter&&) = delete;
+    TelemetryWriter& operator=(TelemetryWriter&&) = delete;
+
+    /// @brief Queues the state of one tick. Call from one thread only,
+    /// normally through the observer from GetObserver(). Ticks started
+    /// after Close() are dropped, as are ticks that do not fit the ring
+    /// when dropping overflowing ticks.
+    void Record(const TickView& view);
+
+    /// @brief Loop-thread observer recording every tick of a world
+    /// @param world World to record
+    TickObserver GetObserver(WorldId world = 0);
+
+    /// @brief Waits for the writer to drain the ring and closes the file.
+    /// Safe while ticks are being recorded: a tick in progress is written
+    /// whole, later ticks are dropped.
+    /// @throws std::runtime_error if writing to the file failed, or if
+    /// ticks were dropped for needing more records than the whole ring
+    void Close();
+
+    /// @brief Ticks queued for writing
+    std::uint64_t GetRecordedTicks() const {
+        return mRecordedTicks.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Ticks skipped because the ring was full
+    std::uint64_t GetDroppedTicks() const {
+        return mDroppedTicks.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Dropped ticks that needed more records than the whole ring;
+    /// a larger ring_capacity or TelemetryOverflow::Block records them
+    std::uint64_t GetOversizedTicks() const {
+        return mOversizedTicks.load(std::memory_order_relaxed);
+    }
+
+   private:
+    /// @brief Pushes the header and particle records of one tick
+    void RecordTick(const TickView& view);
+
+    /// @brief Drains the ring until closed
+    void WriterLoop();
+
+    /// @brief Writes drained records in the configured format
+    void WriteRecords(std::span<const TelemetryRecord> records);
+
+    /// @brief Appends CSV lines for drained records to the batch
+    void FormatCsv(std::span<const TelemetryRecord> records);
+
+    /// @brief Writes the CSV batch to the file
+    void FlushBatch();
+
+    TelemetrySettings mSettings;
+    std::ofstream mFile;
+    threading::SpscRing<TelemetryRecord> mRing;
+
+    // Writer thread state for CSV: the tick being written and how many of
+    // its particle records are still to come
+    std::string mBatch;
+    std::uint64_t mCsvTick{0};
+    double mCsvTime{0.0};
+    std::uint64_t mCsvRowsLeft{0};
+
+    std::atomic<std::uint64_t> mRecordedTicks{0};
+    std::atomic<std::uint64_t> mDroppedTicks{0};
+    std::atomic<std::uint64_t> mOversizedTicks{0};
+    /// Set by Close(); Record() starts no tick once it is seen
+    std::atomic<bool> mClosing{false};
+    /// Record() is between its closing check and its last push
+    std::atomic<bool> mRecording{false};
+    /// Set once no tick is in progress; the writer stops when it has
+    /// drained the ring
+    std::atomic<bool> mFinishing{false};
+    std::thread mWriter;
+};
+
+}  // namespace engine
+}  // namespace solo
+
+#endif  // SOLO_ENGINE_TELEMETRY_WRITER_H
@@ -0,0 +1,102 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_ENGINE_TICK_ARENA_H
+#define SOLO_ENGINE_TICK_ARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+
+namespace solo {
+namespace engine {
+
+/**
+ * @brief Scratch memory that lives for one tick. Allocations bump through
+ * a single buffer and are never freed individually; Reset() rewinds the
+ * whole arena at once. A tick that outgrows the buffer borrows from the
+ * upstream resource, and the next Reset() grows the buffer to fit, so a
+ * steady workload stops touching the upstream after its first ticks.
+ * Not thread-safe.
+ */
+class TickArena {
+   public:
+    static constexpr std::size_t DEFAULT_CAPACITY{64 * 1024};
+
+    /**
+     * @brief Constructs an arena with a buffer taken from upstream.
+     * @param capacity Initial buffer size in bytes.
+     * @param upstream Source of the buffer and of any overflow.
+     */
+    explicit TickArena(std::size_t capacity = DEFAULT_CAPACITY,
+                       std::pmr::memory_resource* upstream =
+                           std::pmr::get_default_resource());
+
+    ~TickArena();
+
+    // Prevent copy and assignment
+    TickArena(const TickArena&) = delete;
+    TickArena& operator=(const TickArena&) = delete;
+
+    // Prevent move and assignment
+    TickArena(TickArena&&) = delete;
+    TickArena& operator=(TickArena&&) = delete;
+
+    /**
+     * @brief Resource handing out memory valid until the next Reset().
+     */
+    std::pmr::memory_resource* GetResource() { return &*mArena; }
+
+    /**
+     * @brief Frees everything allocated since the last reset, growing the
+     * buffer if the arena overflowed it.
+     */
+    void Reset();
+
+    /**
+     * @brief Size of the buffer in bytes.
+     */
+    std::size_t GetCapacity() const { return mCapacity; }
+
+   private:
+    /**
+     * @brief Passes overflow requests upstream, counting their bytes.
+     */
+    class OverflowResource : public std::pmr::memory_resource {
+       public:
+        explicit OverflowResource(std::pmr::memory_resource* upstream)
+            : mUpstream(upstream) {}
+
+        std::size_t GetBytes() const { return mBytes; }
+        void Clear() { mBytes = 0; }
+
+       private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* pointer, std::size_t bytes,
+                           std::size_t alignment) override;
+        bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override;
+
+        std::pmr::memory_resource* mUpstream;
+        std::size_t mBytes{0};
+    };
+
+    std::pmr::memory_resource* mUpstream;
+    OverflowResource mOverflow;
+    std::size_t mCapacity;
+    void* mBuffer;
+    std::optional<std::pmr::monotonic_buffer_resource> mArena;
+};
+
+}  // namespace engine
+}  // namespace solo
+
+#endif  // SOLO_ENGINE_TICK_ARENA_H
@@ -0,0 +1,89 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_ENGINE_TICK_OBSERVER_H
+#define SOLO_ENGINE_TICK_OBSERVER_H
+
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+
+#include "Engine/Command.h"
+#include "Particle/ParticleStore.h"
+
+namespace solo {
+namespace engine {
+
+/// @brief Identifies an observer registered with an Engine
+using ObserverId = std::uint32_t;
+
+/// @brief State of one world after a tick, as seen by an observer. The
+/// store is read-only and only valid during the call; its columns may be
+/// read directly, e.g. Position().x for every x coordinate.
+struct TickView {
+    /// Ticks completed, counting this one
+    std::uint64_t tick{0};
+    /// Simulation time at the end of the tick
+    double simulation_time{0.0};
+    /// World the view belongs to
+    WorldId world{0};
+    /// Particles of the world as the tick left them
+    const physics::ParticleStore* particles{nullptr};
+    /// Scratch memory for the call: the tick arena on the loop thread,
+    /// freed when the next tick starts, or the engine's pool on a worker
+    std::pmr::memory_resource* memory{nullptr};
+};
+
+/// @brief Thread an observer is called on
+enum class ObserverThread : uint8_t {
+    /// The loop thread, in registration order
+    Loop,
+    /// Spread over the thread pool alongside the other worker observers;
+    /// on the loop thread when the engine has no pool
+    Worker
+};
+
+/// @brief Plain function and context called after every tick. Dispatch is
+/// a single indirect call, with no allocation or virtual lookup.
+struct TickObserver {
+    using Function = void (*)(void* context, const TickView& view);
+
+    Function function{nullptr};
+    /// Passed back to the function unchanged
+    void* context{nullptr};
+    /// World whose state is observed
+    WorldId world{0};
+    ObserverThread thread{ObserverThread::Loop};
+    /// Calls taking longer than this many nanoseconds are counted as
+    /// overruns; zero disables the check
+    std::uint64_t budget{0};
+};
+
+/// @brief Builds an observer calling a function or member function known
+/// at compile time, so the call into it can be inlined.
+/// @tparam Callback Free function taking (Context&, const TickView&), or
+/// a member function of Context taking (const TickView&)
+/// @param context Object passed to the callback; must outlive the observer
+/// @return Observer with the remaining fields at their defaults
+template <auto Callback, typename Context>
+TickObserver MakeTickObserver(Context& context) {
+    TickObserver observer;
+    observer.function = [](void* object, const TickView& view) {
+        std::invoke(Callback, *static_cast<Context*>(object), view);
+    };
+    observer.context = &context;
+    return observer;
+}
+
+}  // namespace engine
+}  // namespace solo
+
+#endif  // SOLO_ENGINE_TICK_OBSERVER_H
@@ -0,0 +1,480 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_ENGINE_WORLD_H
+#define SOLO_ENGINE_WORLD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+#include "Engine/Checkpoint.h"
+#include "Engine/Command.h"
+#include "Particle/ParticleStore.h"
+#include "Physics/BarnesHut.h"
+#include "Physics/BroadPhase.h"
+#include "Physics/EmitterRegistry.h"
+#include "Physics/ForceRegistry.h"
+#include "Physics/Integrators.h"
+#include "Physics/Morton.h"
+#include "Physics/RadixSort.h"
+#include "Physics/SpatialGrid.h"
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace engine {
+
+/**
+ * @brief When particles are put to sleep. A particle sleeps once its linear
+ * and angular speed and acceleration have all stayed below the thresholds
+ * for the given number of consecutive ticks.
+ */
+struct SleepSettings {
+    /// Linear speed in m/s and acceleration in m/s^2
+    float linear_threshold{0.01f};
+    /// Angular speed in rad/s and acceleration in rad/s^2
+    float angular_threshold{0.01f};
+    /// Consecutive quiet updates before sleeping; particles in a slow rate
+    /// group are only checked when they update
+    std::uint32_t ticks{60};
+};
+
+/**
+ * @brief Identifies a rate group of a World.
+ */
+using RateGroupId = std::uint32_t;
+
+/**
+ * @brief Time spent in each stage of the last World::Step(), in
+ * nanoseconds.
+ */
+struct WorldStepTimes {
+    std::uint64_t forces{0};
+    std::uint64_t integrate{0};
+    std::uint64_t broad_phase{0};
+    std::uint64_t spatial_index{0};
+};
+
+/**
+ * @brief One independent simulation: a particle store with its own force
+ * stages, integrator and spatial structures. A World does no pacing or
+ * threading of its own; an Engine applies commands to it and steps it
+ * once per tick.
+ */
+class World {
+   public:
+    /**
+     * @brief Receives the overlapping pairs found by a step, on the thread
+     * stepping the world. The pairs are only valid during the call.
+     */
+    using CollisionCallback =
+        std::function<void(const std::vector<physics::CollisionPair>&)>;
+
+    /**
+     * @brief Kernel integrating the dense range [begin, end) of a store
+     * with the given acceleration over a time step.
+     */
+    using IntegrateFunction = void (*)(
+        physics::ParticleStore&, const physics::VectorColumns<float>&,
+        std::size_t, std::size_t, double);
+
+    /**
+     * @brief Rate group every particle starts in, updated every tick.
+     */
+    static constexpr RateGroupId BASE_RATE_GROUP{0};
+
+    /**
+     * @brief Constructs an empty world.
+     * @param integrator Integration scheme for the particle update.
+     * @param resource Source of the scratch memory the force stages use
+     * while stepping; must be thread-safe when steps run on a pool.
+     */
+    explicit World(physics::IntegratorType integrator =
+                       physics::IntegratorType::SymplecticEuler,
+                   std::pmr::memory_resource* resource =
+                       std::pmr::get_default_resource());
+
+    // Prevent copy and assignment
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    // Prevent move and assignment
+    World(World&&) = delete;
+    World& operator=(World&&) = delete;
+
+    /**
+     * @brief Advances the world by one tick.
+     * @param time_step Base time step in seconds.
+     * @param tick Index of the tick, which selects the due rate group
+     * phases.
+     * @param pool Optional pool the stages are split across.
+     */
+    void Step(double time_step, std::uint64_t tick,
+              threading::ThreadPool* pool = nullptr);
+
+    /**
+     * @brief Rewrites the particle columns from the threads that step the
+     * world, so their pages sit on those threads' NUMA nodes.
+     * @param pool Pool later steps run on, or nullptr for the caller.
+     */
+    void FirstTouch(threading::ThreadPool* pool);
+
+    /**
+     * @brief Stage timings of the last Step().
+     */
+    const WorldStepTimes& GetLastStepTimes() const { return mLastStepTimes; }
+
+    /**
+     * @brief Applies a command addressed to this world.
+     * MigrateParticle is handled by the Engine, which owns both worlds.
+     * @param command Mutation to apply.
+     */
+    void ApplyCommand(const Command& command);
+
+    /**
+     * @brief Adds a group of particles updated every divisor ticks, with a
+     * time step of divisor base steps. Members are spread evenly over the
+     * divisor phases, so each tick updates a similar share of the group.
+     * @param divisor Ticks between updates of a member; at least 1.
+     * @return Group id for SetRateGroup commands.
+     */
+    RateGroupId AddRateGroup(std::uint32_t divisor);
+
+    /**
+     * @brief Number of rate groups, including the base group.
+     */
+    std::size_t GetRateGroupCount() const { return mRateGroups.size(); }
+
+    /**
+     * @brief Rate group timing and emitted particle lifetimes, for a
+     * checkpoint saved with the store.
+     */
+    CheckpointSchedule GetSchedule() const;
+
+    /**
+     * @brief Restores the state returned by GetSchedule() after the store
+     * has been replaced with the particles saved alongside it. The world
+     * must have the same rate groups as the one that saved it.
+     */
+    void RestoreSchedule(const CheckpointSchedule& schedule);
+
+    /**
+     * @brief Selects the integration scheme and clears the history the
+     * previous scheme kept.
+     */
+    void SetIntegrator(physics::IntegratorType integrator);
+
+    /**
+     * @brief Integration scheme in use.
+     */
+    physics::IntegratorType GetIntegrator() const { return mIntegratorType; }
+
+    /**
+     * @brief Integrates positions as float offsets from per-region double
+     * origins, so the update kernel runs on floats alone. The store's
+     * Position() columns are then only brought up to date by
+     * SyncPositions(), which the world calls itself before the stages that
+     * read them.
+     * @param region_size Edge of a region in metres.
+     * @throws std::logic_error under closed-form motion.
+     */
+    void EnableLocalFrames(
+        double region_size = physics::ParticleStore::DEFAULT_REGION_SIZE);
+
+    /**
+     * @brief Moves every particle in closed form from the state it had when
+     * last changed, taking its accelerations as constant, instead of
+     * integrating it. A step then only advances the store's motion time,
+     * so its cost follows the number of particles changed rather than the
+     * number held; positions are worked out when they are read. Rate
+     * groups and sleeping have no effect. The store's columns are brought
+     * up to date by SyncPositions(), as with local frames.
+     * @throws std::logic_error if force stages or local frames are enabled.
+     */
+    void EnableClosedFormMotion();
+
+    /**
+     * @brief Brings the store's Position() columns up to date after steps
+     * integrated in local frames or taken in closed form; does nothing when
+     * they are current.
+     * @param pool Optional pool the copy is split across.
+     */
+    void SyncPositions(threading::ThreadPool* pool = nullptr);
+
+    /**
+     * @brief Puts particles that stay still to sleep. Sleeping particles
+     * are skipped by the update until a command or force generator wakes
+     * them. Ignored while gravity is enabled.
+     */
+    void EnableSleeping(const SleepSettings& settings = {});
+
+    /**
+     * @brief Number of particles the next step will update.
+     */
+    std::size_t GetAwakeParticleCount() const {
+        return mParticles.GetAwakeCount();
+    }
+
+    /**
+     * @brief Number of particles in the world.
+     */
+    std::size_t GetParticleCount() const { return mParticles.size(); }
+
+    /**
+     * @brief Adds Barnes-Hut mutual gravity between the particles.
+     * @throws std::logic_error under closed-form motion.
+     */
+    void EnableGravity(const physics::BarnesHutSettings& settings = {});
+
+    /**
+     * @brief Registers a force generator and wakes the particles it
+     * selects.
+     * @return Id for RemoveForceGenerator().
+     * @throws std::logic_error under closed-form motion.
+     */
+    physics::ForceGeneratorId AddForceGenerator(
+        const physics::ForceGenerator& generator);
+
+    /**
+     * @brief Unregisters a force generator and wakes the particles it
+     * selected.
+     * @return False if no generator has the id.
+     */
+    bool RemoveForceGenerator(physics::ForceGeneratorId id);
+
+    /**
+     * @brief Registers an emitter. Its particles join the base rate group
+     * at the start of each step and are removed there once their lifetime
+     * ends.
+     * @return Id for RemoveEmitter() and EmitBurst().
+     * @throws std::invalid_argument if the emitter's settings are invalid.
+     */
+    physics::EmitterId AddEmitter(const physics::Emitter& emitter);
+
+    /**
+     * @brief Unregisters an emitter; its particles live out their
+     * lifetimes.
+     * @return False if no emitter has the id.
+     */
+    bool RemoveEmitter(physics::EmitterId id);
+
+    /**
+     * @brief Spawns particles from an emitter in one batch at the start of
+     * the next step.
+     * @return False if no emitter has the id.
+     */
+    bool EmitBurst(physics::EmitterId id, std::size_t count);
+
+    /**
+     * @brief Emitters of the world.
+     */
+    const physics::EmitterRegistry& GetEmitters() const { return mEmitters; }
+
+    /**
+     * @brief Finds overlapping particles every step.
+     */
+    void EnableBroadPhase(CollisionCallback callback = {});
+
+    /**
+     * @brief Overlapping pairs found by the last step; empty when the
+     * broad phase is disabled.
+     */
+    const std::vector<physics::CollisionPair>& GetCollisionPairs() const;
+
+    /**
+     * @brief Rebuilds a uniform grid over the particles every step.
+     * @param cell_size Edge length of a grid cell.
+     * @throws std::invalid_argument if cell_size is not positive and
+     * finite.
+     */
+    void EnableSpatialIndex(double cell_size);
+
+    /**
+     * @brief Grid built by the last step, or nullptr when disabled.
+     */
+    const physics::SpatialGrid* GetSpatialIndex() const {
+        return mSpatialIndex.get();
+    }
+
+    /**
+     * @brief Sorts the particles of each store group, and the sleeping
+     * ones, by the Morton code of their position every few ticks, after
+     * integration. Particles close in space then sit close in memory for
+     * the broad phase, spatial index and gravity. Handles stay valid;
+     * dense indices change. The sort counts towards the integrate stage
+     * time.
+     * @param cadence Ticks between sorts; at least 1.
+     * @throws std::invalid_argument if cadence is zero.
+     */
+    void EnableMortonOrder(std::uint32_t cadence);
+
+    /**
+     * @brief Particle store of the world.
+     */
+    physics::ParticleStore& GetParticles() { return mParticles; }
+
+    /**
+     * @brief Read-only particle store of the world.
+     */
+    const physics::ParticleStore& GetParticles() const { return mParticles; }
+
+   private:
+    /**
+     * @brief Particles updated every divisor ticks. Phase p of the group
+     * is store group first_group + p.
+     */
+    struct RateGroup {
+        std::uint32_t divisor{1};
+        std::uint32_t first_group{0};
+        /// Particles assigned to each phase
+        std::vector<std::size_t> members;
+    };
+
+    /**
+     * @brief Morton code of a particle and its offset in its sorted range.
+     */
+    struct MortonEntry {
+        std::uint64_t code{0};
+        std::uint32_t index{0};
+    };
+
+    /**
+     * @brief Store group updated this tick, with its time step.
+     */
+    struct DueGroup {
+        std::uint32_t group{0};
+        double time_step{0.0};
+    };
+
+    /**
+     * @brief Particle that joined a store group since the group was last
+     * advanced, with the simulated time its own state is at.
+     */
+    struct Joiner {
+        physics::ParticleHandle handle;
+        double time{0.0};
+    };
+
+    /**
+     * @brief Collects the store groups whose phase falls on a tick, each
+     * with the time passed since it was last advanced.
+     */
+    void ScheduleGroups(std::uint64_t tick);
+
+    /**
+     * @brief Integrates the awake particles of a due group. Particles that
+     * joined it since it was last advanced cover their own elapsed time.
+     */
+    void IntegrateGroup(const DueGroup& due,
+                        const physics::VectorColumns<float>& acceleration,
+                        threading::ThreadPool* pool);
+
+    /**
+     * @brief Moves a particle to the least loaded phase of a rate group.
+     * @param index Dense index of the particle.
+     * @param group Target rate group.
+     * @param time Simulated time the particle's state is at.
+     */
+    void AssignRateGroup(std::size_t index, RateGroupId group, double time);
+
+    /**
+     * @brief Forgets the particle at a dense index before it is removed
+     * or moved to another group.
+     * @return Simulated time the particle's state is at.
+     */
+    double LeaveRateGroup(std::size_t index);
+
+    /**
+     * @brief Removes the emitted particles whose lifetime has ended and
+     * spawns those due over the step.
+     */
+    void UpdateEmitters(double time_step);
+
+    /**
+     * @brief Sorts each store group and the sleeping range by Morton code
+     * within a cube around every particle.
+     */
+    void SortByMorton(threading::ThreadPool* pool);
+
+    /**
+     * @brief Runs the enabled force stages over the due groups.
+     * @return Acceleration to integrate this step.
+     */
+    const physics::VectorColumns<float>& ApplyForces(
+        threading::ThreadPool* pool);
+
+    /**
+     * @brief Counts quiet updates of the due groups and puts those that
+     * reach the limit to sleep.
+     * @param acceleration Net acceleration integrated this step.
+     */
+    void UpdateSleep(const physics::VectorColumns<float>& acceleration,
+                     threading::ThreadPool* pool);
+
+    /**
+     * @brief Advances the idle count of every particle in a store group.
+     */
+    void CountQuietUpdates(const physics::VectorColumns<float>& acceleration,
+                           std::uint32_t group, threading::ThreadPool* pool);
+
+    /**
+     * @brief Wakes the sleeping particles a force generator selects.
+     */
+    void WakeTagged(std::uint32_t tags);
+
+    physics::ParticleStore mParticles;
+    std::pmr::memory_resource* mResource;
+    physics::IntegratorType mIntegratorType;
+    IntegrateFunction mIntegrate;
+    /// Local frames or the motion time moved since the Position() columns
+    /// were last synced
+    bool mPositionsStale{false};
+    std::unique_ptr<physics::SpatialGrid> mSpatialIndex;
+    /// Ticks between Morton sorts; zero when disabled
+    std::uint32_t mMortonCadence{0};
+    std::vector<MortonEntry> mMortonOrder;
+    std::vector<MortonEntry> mMortonScratch;
+    std::vector<std::uint32_t> mPermutation;
+    /// Sort buffers kept between sorts, so a sort allocates nothing once
+    /// they reach the particle count
+    std::vector<physics::PositionBounds> mMortonBounds;
+    std::vector<physics::RadixCounts> mRadixCounts;
+    physics::ForceRegistry mForces;
+    physics::EmitterRegistry mEmitters;
+    std::optional<SleepSettings> mSleep;
+    std::vector<RateGroup> mRateGroups;
+    /// Rate group owning each store group
+    std::vector<RateGroupId> mGroupOwners;
+    /// Simulated time the world has been stepped through
+    double mTime{0.0};
+    /// Simulated time each store group was last advanced to
+    std::vector<double> mGroupTimes;
+    /// Particles that joined each store group since it was last advanced
+    std::vector<std::vector<Joiner>> mGroupJoiners;
+    /// Dense index and time step of each joiner of the group integrated
+    std::vector<std::pair<std::size_t, double>> mJoinerSteps;
+    std::vector<DueGroup> mDueGroups;
+    std::unique_ptr<physics::BarnesHut> mGravity;
+    physics::VectorColumns<float> mNetAcceleration;
+    std::unique_ptr<physics::BroadPhase> mBroadPhase;
+    CollisionCallback mCollisionCallback;
+    std::vector<physics::CollisionPair> mNoCollisionPairs;
+    WorldStepTimes mLastStepTimes;
+};
+
+}  // namespace engine
+}  // namespace solo
+
+#endif  // SOLO_ENGINE_WORLD_H
@@ -12,6 +12,7 @@
 #ifndef SOLO_MATH_KINEMATICS_H
 #define SOLO_MATH_KINEMATICS_H
 
+#include <memory_resource>
 #include <vector>
 
 #include "EulerAngles.h"
@@ -173,21 +174,25 @@ class Kinematic {
     /// @param StartPosition
     /// @param EndPosition
     /// @param NumberOfPoints
+    /// @param Resource source of the returned points, e.g. a tick arena
     /// @return
-    std::vector<solo::math::WorldCoordinates> GenerateSmoothingPoints(
+    std::pmr::vector<solo::math::WorldCoordinates> GenerateSmoothingPoints(
         const solo::math::WorldCoordinates& StartPosition,
         const solo::math::WorldCoordinates& EndPosition,
-        uint32_t NumberOfPoints);
+        uint32_t NumberOfPoints,
+        std::pmr::memory_resource* Resource = std::pmr::get_default_resource());
 
     /// @brief Generates smoothing points between to locations
     /// @param StartPosition const WorldCoordinates
     /// @param EndPosition const WorldCoordinates
     /// @param NumberOfPoints const WorldCoordinates
-    /// @param v resultant vector of points
+    /// @param v resultant vector of points; its allocator is kept, so a
+    /// reused vector stops allocating once it has grown
     void GenerateSmoothingPoints(
         const solo::math::WorldCoordinates& StartPosition,
         const solo::math::WorldCoordinates& EndPosition,
-        uint32_t NumberOfPoints, std::vector<solo::math::WorldCoordinates>& v);
+        uint32_t NumberOfPoints,
+        std::pmr::vector<solo::math::WorldCoordinates>& v);
 };
 
 }  // namespace math
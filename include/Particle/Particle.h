@@ -12,6 +12,8 @@
 #ifndef SOLO_PHYSICS_PARTICLE_H
 #define SOLO_PHYSICS_PARTICLE_H
 
+#include <cstdint>
+
 #include "Math/Matrix.h"
 #include "Math/Vector.h"
 #include "Coordinates/WorldCoordinates.h"
@@ -34,6 +36,8 @@ class Particle {
     math::Vector GetAngle() const;
     math::Vector GetAngularVelocity() const;
     math::Vector GetAngularAcceleration() const;
+    float GetRadius() const;
+    std::uint32_t GetTags() const;
     // Setters
     void SetMass(double mass);
     void SetPosition(const math::WorldCoordinates& position);
@@ -42,8 +46,14 @@ class Particle {
     void SetAngle(const math::Vector& angle);
     void SetAngularVelocity(const math::Vector& angular_velocity);
     void SetAngularAcceleration(const math::Vector& angular_acceleration);
+    /// @brief Sets the collision radius; zero leaves the particle without
+    /// extent, so it never collides.
+    void SetRadius(float radius);
+    /// @brief Sets the tag bits that force generators select particles by.
+    void SetTags(std::uint32_t tags);
 
-    /// @brief Update the particle's position based on its velocity and a time step.
+    /// @brief Advances the particle one step with semi-implicit Euler, the
+    /// engine's default integrator.
     /// @param time_step Delta time for the physical update.
     void Update(double time_step);
 
@@ -59,6 +69,12 @@ class Particle {
     math::Vector mAngle;
     math::Vector mAngularVelocity;
     math::Vector mAngularAcceleration;
+
+    // Extent
+    float mRadius{0.0f};
+
+    // Grouping
+    std::uint32_t mTags{0};
 };
 
 }  // namespace physics
@@ -0,0 +1,80 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_PHYSICS_PARTICLE_HANDLE_H
+#define SOLO_PHYSICS_PARTICLE_HANDLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Threading/MpmcQueue.h"
+
+namespace solo {
+namespace physics {
+
+/// @brief Stable reference to a particle.
+/// The index names a slot of the store's slot map, the generation tells a
+/// live particle apart from earlier occupants of the same slot.
+struct ParticleHandle {
+    static constexpr std::uint32_t INVALID_INDEX{0xFFFFFFFF};
+
+    std::uint32_t index{INVALID_INDEX};
+    std::uint32_t generation{0};
+
+    /// @brief True when the handle was issued by a store
+    bool IsValid() const { return index != INVALID_INDEX; }
+
+    bool operator==(const ParticleHandle& value) const = default;
+};
+
+/// @brief Hands out slot map handles.
+/// Reserve() is lock-free and may be called from any thread, so producers
+/// get a handle back before the simulation loop applies their add. Freed
+/// slots are recycled through a bounded MPMC ring by the owning thread;
+/// when that is empty a fresh slot index is taken from a counter.
+class HandleAllocator {
+   public:
+    static constexpr std::size_t DEFAULT_RECYCLE_CAPACITY{65536};
+
+    /// @brief Constructs the allocator
+    /// @param recycle_capacity Freed slots held ready for reuse
+    /// @param first_index Slot index handed out first once nothing is
+    /// recycled; slots below it are assumed to exist already
+    explicit HandleAllocator(
+        std::size_t recycle_capacity = DEFAULT_RECYCLE_CAPACITY,
+        std::uint32_t first_index = 0);
+
+    /// @brief Reserves a handle. Safe from any thread.
+    /// @return Handle that is not held by any live particle
+    ParticleHandle Reserve();
+
+    /// @brief Returns a slot for reuse. Owning thread only.
+    /// @param handle Freed slot, carrying the generation its next occupant
+    /// will use
+    void Recycle(ParticleHandle handle);
+
+    /// @brief Number of slot indices handed out so far
+    std::uint32_t GetSlotCount() const {
+        return mNextIndex.load(std::memory_order_acquire);
+    }
+
+   private:
+    threading::MpmcQueue<ParticleHandle> mFree;
+    std::vector<ParticleHandle> mOverflow;
+    std::atomic<std::uint32_t> mNextIndex{0};
+};
+
+}  // namespace physics
+}  // namespace solo
+
+#endif  // SOLO_PHYSICS_PARTICLE_HANDLE_H
@@ -0,0 +1,579 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_PHYSICS_PARTICLE_STORE_H
+#define SOLO_PHYSICS_PARTICLE_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Math/Vector.h"
+#include "Particle/Particle.h"
+#include "Particle/ParticleHandle.h"
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace physics {
+
+/// @brief Three parallel columns holding the x, y and z components of a
+/// per-particle vector quantity.
+template <typename T>
+struct VectorColumns {
+    std::vector<T> x;
+    std::vector<T> y;
+    std::vector<T> z;
+};
+
+class ParticleStore;
+
+/// @brief Lightweight proxy exposing the Particle interface over a single
+/// entry of a ParticleStore.
+/// The proxy addresses a dense index, so it is only valid until the next
+/// add or remove; hold a ParticleHandle across ticks instead.
+class ParticleRef {
+   public:
+    /// @brief Constructs a proxy to an entry of the store
+    /// @param store Owning store
+    /// @param index Dense index of the entry
+    ParticleRef(ParticleStore& store, std::size_t index);
+
+    // Getters
+    double GetMass() const;
+    math::WorldCoordinates GetPosition() const;
+    math::Vector GetVelocity() const;
+    math::Vector GetAcceleration() const;
+    math::Vector GetAngle() const;
+    math::Vector GetAngularVelocity() const;
+    math::Vector GetAngularAcceleration() const;
+    float GetRadius() const;
+    std::uint32_t GetTags() const;
+    // Setters; the motion setters wake a sleeping entry at the next step
+    void SetMass(double mass);
+    void SetPosition(const math::WorldCoordinates& position);
+    void SetVelocity(const math::Vector& velocity);
+    void SetAcceleration(const math::Vector& acceleration);
+    void SetAngle(const math::Vector& angle);
+    void SetAngularVelocity(const math::Vector& angular_velocity);
+    void SetAngularAcceleration(const math::Vector& angular_acceleration);
+    void SetRadius(float radius);
+    void SetTags(std::uint32_t tags);
+
+    /// @brief Dense index of the referenced entry
+    /// @return index into the store columns
+    std::size_t GetIndex() const { return mIndex; }
+
+    /// @brief Stable handle of the referenced entry
+    /// @return handle valid until the particle is removed
+    ParticleHandle GetHandle() const;
+
+    /// @brief Copies the referenced state into a standalone Particle
+    /// @return Particle holding the same state
+    Particle ToParticle() const;
+
+   private:
+    ParticleStore* mStore;
+    std::size_t mIndex;
+};
+
+/// @brief Structure-of-arrays container for particle state.
+/// Each component of each quantity lives in its own contiguous column so the
+/// integration kernels stream through memory and can be vectorised.
+/// A slot map of generational handles sits in front of the dense columns:
+/// lookups are O(1) and removal swaps the last entry into the hole, keeping
+/// the columns packed.
+/// The dense range is partitioned into awake entries, [0, GetAwakeCount()),
+/// followed by sleeping ones, so update loops can skip the sleepers without
+/// testing each entry. The awake range is further ordered by group, so each
+/// group is a contiguous range that can be updated on its own.
+class ParticleStore {
+   public:
+    static constexpr std::size_t NPOS{~std::size_t{0}};
+
+    /// @brief Region edge used by EnableLocalFrames() unless told otherwise
+    static constexpr double DEFAULT_REGION_SIZE{1024.0};
+
+    /// @brief Forward iterator yielding ParticleRef proxies
+    class Iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ParticleRef;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = ParticleRef;
+
+        Iterator() = default;
+        Iterator(ParticleStore* store, std::size_t index)
+            : mStore(store), mIndex(index) {}
+
+        ParticleRef operator*() const { return {*mStore, mIndex}; }
+        Iterator& operator++() {
+            ++mIndex;
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator tmp = *this;
+            ++mIndex;
+            return tmp;
+        }
+        bool operator==(const Iterator& other) const {
+            return mIndex == other.mIndex;
+        }
+
+       private:
+        ParticleStore* mStore{nullptr};
+        std::size_t mIndex{0};
+    };
+
+    ParticleStore();
+
+    /// @brief Appends a particle, splitting its state across the columns
+    /// @param particle Particle to copy in
+    /// @return Handle of the new entry
+    ParticleHandle Add(const Particle& particle);
+
+    /// @brief Appends copies of a particle, filling each column in one go
+    /// @param particle Particle to copy in
+    /// @param count Number of copies
+    /// @return Index range of the copies, contiguous at the end of the
+    /// first group
+    std::pair<std::size_t, std::size_t> AddCopies(const Particle& particle,
+                                                  std::size_t count);
+
+    /// @brief Reserves a handle for a later Insert(). Safe from any thread.
+    /// @return Handle not held by any live particle
+    ParticleHandle ReserveHandle();
+
+    /// @brief Appends a particle under a handle from ReserveHandle()
+    /// @param particle Particle to copy in
+    /// @param handle Reserved handle
+    void Insert(const Particle& particle, ParticleHandle handle);
+
+    /// @brief Gives back a handle from ReserveHandle() that will not be
+    /// inserted. The handle stays stale; its slot is reused under the next
+    /// generation.
+    /// @param handle Reserved handle
+    void ReleaseHandle(ParticleHandle handle);
+
+    /// @brief Removes a particle by moving the last entry into its place
+    /// @param handle Particle to remove
+    /// @return False if the handle is stale
+    bool Remove(ParticleHandle handle);
+
+    /// @brief Removes an entry by moving the last entry into its place
+    /// @param index Dense index to remove
+    /// @throws std::out_of_range for invalid indices
+    void RemoveAt(std::size_t index);
+
+    /// @brief Removes a batch of particles. Large batches are removed in
+    /// one pass over the columns that keeps the survivors in order, rather
+    /// than with a swap against the last entry each.
+    /// @param handles Particles to remove; stale handles are skipped
+    /// @return Number of particles removed
+    std::size_t RemoveBatch(const std::vector<ParticleHandle>& handles);
+
+    /// @brief Dense index of a particle
+    /// @param handle Particle to look up
+    /// @return Dense index, or NPOS if the handle is stale
+    std::size_t IndexOf(ParticleHandle handle) const;
+
+    /// @brief True if the handle refers to a live particle
+    bool Contains(ParticleHandle handle) const {
+        return IndexOf(handle) != NPOS;
+    }
+
+    /// @brief Proxy for a particle looked up by handle
+    /// @param handle Particle to look up
+    /// @return Proxy, empty if the handle is stale
+    std::optional<ParticleRef> Find(ParticleHandle handle);
+
+    /// @brief Handle of the entry at a dense index
+    ParticleHandle GetHandle(std::size_t index) const {
+        return mHandles[index];
+    }
+
+    /// @brief Exchanges two entries in every column, updating the slot map.
+    /// The partitions are not maintained, so callers swap within a group.
+    /// @param first Dense index
+    /// @param second Dense index
+    void Swap(std::size_t first, std::size_t second);
+
+    /// @brief Number of awake entries, which lead the dense range
+    std::size_t GetAwakeCount() const { return mGroupStart.back(); }
+
+    /// @brief True if the entry is in the awake partition
+    bool IsAwake(std::size_t index) const { return index < GetAwakeCount(); }
+
+    /// @brief Moves an entry into the awake partition, within its group,
+    /// and clears its idle tick count
+    /// @param index Dense index
+    /// @return New dense index of the entry
+    std::size_t Wake(std::size_t index);
+
+    /// @brief Moves an entry into the sleeping partition
+    /// @param index Dense index
+    /// @return New dense index of the entry
+    std::size_t Sleep(std::size_t index);
+
+    /// @brief Wakes every entry
+    void WakeAll();
+
+    /// @brief Wakes the sleepers a setter touched since the last call.
+    /// The setters only record the wake, so a ParticleRef stays on its
+    /// entry; the world applies them at the start of each step.
+    void ApplyPendingWakes();
+
+    /// @brief Number of groups the awake range is ordered by
+    std::size_t GetGroupCount() const { return mGroupStart.size() - 1; }
+
+    /// @brief Moves an entry to another group, creating the group if needed
+    /// @param index Dense index
+    /// @param group Group id; new entries start in group 0
+    /// @return New dense index of the entry
+    std::size_t SetGroup(std::size_t index, std::uint32_t group);
+
+    /// @brief Awake entries of a group
+    /// @param group Group id
+    /// @return Dense range [first, second), empty for unknown groups
+    std::pair<std::size_t, std::size_t> GetGroupRange(
+        std::uint32_t group) const;
+
+    /// @brief Reserves capacity in every column
+    /// @param capacity Number of particles to reserve space for
+    void Reserve(std::size_t capacity);
+
+    /// @brief Removes every particle
+    void Clear();
+
+    /// @brief Rearranges a range of entries in every column, updating the
+    /// slot map so handles follow their particles. The partitions are not
+    /// maintained, so callers reorder within a group.
+    /// @param begin First dense index of the range
+    /// @param order Entry begin + k takes the former entry begin + order[k]
+    /// @param pool Pool to gather the columns on, or nullptr for the caller
+    /// @param grain Chunk size of the gather loops
+    void Reorder(std::size_t begin, const std::vector<std::uint32_t>& order,
+                 threading::ThreadPool* pool, std::size_t grain);
+
+    /// @brief Rewrites every column from the threads that update it, so on
+    /// NUMA machines each thread's block of entries sits on its own node.
+    /// Entries added later are placed by the thread that adds them.
+    /// @param pool Pool the update runs on, or nullptr for the caller
+    /// @param grain Chunk size of the update loops
+    void FirstTouch(threading::ThreadPool* pool, std::size_t grain);
+
+    /// @brief Keeps every position as a float offset from the double origin
+    /// of the region it lies in, so the integration kernels run entirely on
+    /// floats. Regions are cubes on a grid of the given edge; once an entry
+    /// strays a whole edge from its origin, the kernel calls Rebase() on its
+    /// range. The Position() columns then hold origin plus offset as of the
+    /// last SyncPositions(); GetPosition() and ParticleRef are always exact,
+    /// and positions must be written through them rather than the columns.
+    /// Calling it again changes the region size.
+    /// @param region_size Edge of a region in metres; smaller regions keep
+    /// more precision and rebase more often
+    /// @throws std::invalid_argument unless region_size is positive and
+    /// finite
+    /// @throws std::logic_error under closed-form motion
+    void EnableLocalFrames(double region_size = DEFAULT_REGION_SIZE);
+
+    /// @brief True once EnableLocalFrames() has been called
+    bool HasLocalFrames() const { return mRegionSize > 0.0; }
+
+    /// @brief Region edge of the local frames, zero when they are disabled
+    double GetRegionSize() const { return mRegionSize; }
+
+    /// @brief Moves the entries of [begin, end) more than half a region
+    /// from their origin onto the region they are now in, leaving each
+    /// within half a region of its origin. Safe to run on disjoint ranges
+    /// at once.
+    /// @return Number of entries rebased
+    std::size_t Rebase(std::size_t begin, std::size_t end);
+
+    /// @brief Moves every entry in closed form from a reference state
+    /// rather than leaving it to the integration kernels. Each entry keeps
+    /// its position, velocity, angle and angular velocity as of a reference
+    /// time, and its accelerations are taken as constant since then, so its
+    /// state at the store's motion time is worked out when it is read.
+    /// Changing an entry moves its reference time up to the motion time
+    /// first. The position, velocity, angle and angular velocity columns
+    /// then hold the state as of the last SyncPositions(); the per-entry
+    /// getters and ParticleRef are always exact, and that state must be
+    /// written through them rather than the columns.
+    /// @throws std::logic_error if local frames are enabled
+    void EnableClosedFormMotion();
+
+    /// @brief True once EnableClosedFormMotion() has been called
+    bool HasClosedFormMotion() const { return mClosedForm; }
+
+    /// @brief Time the closed-form state is evaluated at, in seconds
+    double GetMotionTime() const { return mMotionTime; }
+
+    /// @brief Moves the closed-form state forward; nothing else is touched
+    /// @param time_step Seconds to advance
+    void AdvanceMotionTime(double time_step) { mMotionTime += time_step; }
+
+    /// @brief Rewrites the Position() columns of [begin, end) from the
+    /// local frames, or under closed-form motion the position, velocity,
+    /// angle and angular velocity columns from the reference state. Safe to
+    /// run on disjoint ranges at once.
+    void SyncPositions(std::size_t begin, std::size_t end);
+
+    /// @brief Position of an entry, exact even while the Position() columns
+    /// wait for SyncPositions()
+    /// @param index Dense index
+    math::WorldCoordinates GetPosition(std::size_t index) const;
+
+    /// @brief Velocity of an entry, exact even while the Velocity() columns
+    /// wait for SyncPositions()
+    /// @param index Dense index
+    math::Vector GetVelocity(std::size_t index) const;
+
+    /// @brief Angle of an entry, exact even while the Angle() columns wait
+    /// for SyncPositions()
+    /// @param index Dense index
+    math::Vector GetAngle(std::size_t index) const;
+
+    /// @brief Angular velocity of an entry, exact even while the
+    /// AngularVelocity() columns wait for SyncPositions()
+    /// @param index Dense index
+    math::Vector GetAngularVelocity(std::size_t index) const;
+
+    /// @brief Moves an entry, keeping its local frame or reference state in
+    /// step. Like the setters below, it clears the idle tick count and
+    /// wakes a sleeping entry at the next ApplyPendingWakes().
+    /// @param index Dense index
+    /// @param position New position
+    void SetPosition(std::size_t index, const math::WorldCoordinates& position);
+
+    // Setters keeping the reference state of closed-form motion in step
+    void SetVelocity(std::size_t index, const math::Vector& velocity);
+    void SetAcceleration(std::size_t index, const math::Vector& acceleration);
+    void SetAngle(std::size_t index, const math::Vector& angle);
+    void SetAngularVelocity(std::size_t index,
+                            const math::Vector& angular_velocity);
+    void SetAngularAcceleration(std::size_t index,
+                                const math::Vector& angular_acceleration);
+
+    /// @brief Number of slot indices handed out, including free slots
+    std::uint32_t GetSlotCount() const { return mAllocator->GetSlotCount(); }
+
+    /// @brief Generation a slot currently holds, or will issue next when free
+    /// @param slot Slot index below GetSlotCount()
+    std::uint32_t GetSlotGeneration(std::uint32_t slot) const;
+
+    /// @brief Rebuilds the slot map from saved state, e.g. a checkpoint.
+    /// The caller fills every column to handles.size() entries; slots not
+    /// referenced by a handle are recycled with their saved generation.
+    /// Throws std::invalid_argument if the handles and generations disagree.
+    /// @param handles Handle of each dense entry
+    /// @param generations Generation of every slot
+    void RestoreSlots(std::vector<ParticleHandle> handles,
+                      const std::vector<std::uint32_t>& generations);
+
+    /// @brief Restores the groups and sleep state saved with the columns,
+    /// after RestoreSlots(). Throws std::invalid_argument if an awake entry
+    /// lies outside its group's range or the ranges are out of order.
+    /// @param groups Group of each dense entry
+    /// @param idle_ticks Idle tick count of each dense entry
+    /// @param group_start Start of each group, then the end of the awake
+    /// range
+    /// @param pending_wakes Sleepers waiting for ApplyPendingWakes()
+    void RestoreGroups(std::vector<std::uint32_t> groups,
+                       std::vector<std::uint32_t> idle_ticks,
+                       std::vector<std::size_t> group_start,
+                       std::vector<ParticleHandle> pending_wakes);
+
+    /// @brief Forgets the acceleration of the last integration step, so
+    /// integrators that use it restart from the next step's acceleration
+    void ResetIntegratorHistory();
+
+    /// @brief Copies an entry out into a standalone Particle
+    /// @param index Dense index
+    /// @return Particle holding the entry state
+    Particle Get(std::size_t index) const;
+
+    /// @brief Number of particles held
+    std::size_t size() const { return mMass.size(); }
+
+    /// @brief True when no particles are held
+    bool empty() const { return mMass.empty(); }
+
+    /// @brief Unchecked access to an entry
+    /// @param index Dense index
+    ParticleRef operator[](std::size_t index) { return {*this, index}; }
+
+    /// @brief Checked access to an entry
+    /// @param index Dense index
+    /// @throws std::out_of_range for invalid indices
+    ParticleRef at(std::size_t index);
+
+    Iterator begin() { return {this, 0}; }
+    Iterator end() { return {this, size()}; }
+
+    // Column access
+    const std::vector<ParticleHandle>& Handles() const { return mHandles; }
+    std::vector<double>& Mass() { return mMass; }
+    const std::vector<double>& Mass() const { return mMass; }
+    VectorColumns<double>& Position() { return mPosition; }
+    const VectorColumns<double>& Position() const { return mPosition; }
+    VectorColumns<float>& Velocity() { return mVelocity; }
+    const VectorColumns<float>& Velocity() const { return mVelocity; }
+    VectorColumns<float>& Acceleration() { return mAcceleration; }
+    const VectorColumns<float>& Acceleration() const { return mAcceleration; }
+    VectorColumns<float>& Angle() { return mAngle; }
+    const VectorColumns<float>& Angle() const { return mAngle; }
+    VectorColumns<float>& AngularVelocity() { return mAngularVelocity; }
+    const VectorColumns<float>& AngularVelocity() const {
+        return mAngularVelocity;
+    }
+    VectorColumns<float>& AngularAcceleration() {
+        return mAngularAcceleration;
+    }
+    const VectorColumns<float>& AngularAcceleration() const {
+        return mAngularAcceleration;
+    }
+    std::vector<float>& Radius() { return mRadius; }
+    const std::vector<float>& Radius() const { return mRadius; }
+    std::vector<std::uint32_t>& Tags() { return mTags; }
+    const std::vector<std::uint32_t>& Tags() const { return mTags; }
+    /// Group of each entry, kept while it sleeps
+    const std::vector<std::uint32_t>& Groups() const { return mGroups; }
+    /// Sleepers a setter touched since the last ApplyPendingWakes()
+    const std::vector<ParticleHandle>& PendingWakes() const {
+        return mPendingWakes;
+    }
+    /// Consecutive updates an awake entry has been nearly still
+    std::vector<std::uint32_t>& IdleTicks() { return mIdleTicks; }
+    const std::vector<std::uint32_t>& IdleTicks() const { return mIdleTicks; }
+    /// Offset of each entry from its region origin; empty unless local
+    /// frames are enabled
+    VectorColumns<float>& LocalPosition() { return mLocalPosition; }
+    const VectorColumns<float>& LocalPosition() const {
+        return mLocalPosition;
+    }
+    /// Origin of the region each entry lies in; empty unless local frames
+    /// are enabled
+    const VectorColumns<double>& Origin() const { return mOrigin; }
+    /// Net acceleration of the last integration step, NaN before the first
+    VectorColumns<float>& PreviousAcceleration() {
+        return mPreviousAcceleration;
+    }
+    const VectorColumns<float>& PreviousAcceleration() const {
+        return mPreviousAcceleration;
+    }
+
+   private:
+    static constexpr std::uint32_t NO_ENTRY{0xFFFFFFFF};
+
+    /// @brief Slot map entry: where a handle lives in the dense columns
+    struct Slot {
+        std::uint32_t dense{NO_ENTRY};
+        std::uint32_t generation{0};
+    };
+
+    // Slot map
+    std::unique_ptr<HandleAllocator> mAllocator;
+    std::vector<Slot> mSlots;
+    std::vector<ParticleHandle> mHandles;
+
+    std::vector<double> mMass;
+
+    // Position
+    VectorColumns<double> mPosition;
+    VectorColumns<float> mVelocity;
+    VectorColumns<float> mAcceleration;
+
+    // Angle (Rotation)
+    VectorColumns<float> mAngle;
+    VectorColumns<float> mAngularVelocity;
+    VectorColumns<float> mAngularAcceleration;
+
+    // Local frames: position = origin + local, each origin a multiple of
+    // the region size
+    VectorColumns<float> mLocalPosition;
+    VectorColumns<double> mOrigin;
+    double mRegionSize{0.0};
+
+    // Closed-form motion: the state of each entry at its reference time
+    VectorColumns<double> mReferencePosition;
+    VectorColumns<float> mReferenceVelocity;
+    VectorColumns<float> mReferenceAngle;
+    VectorColumns<float> mReferenceAngularVelocity;
+    std::vector<double> mReferenceTime;
+    double mMotionTime{0.0};
+    bool mClosedForm{false};
+
+    // Extent
+    std::vector<float> mRadius;
+
+    // Grouping
+    std::vector<std::uint32_t> mTags;
+
+    // Integrator state
+    VectorColumns<float> mPreviousAcceleration;
+
+    /// @brief Points an entry's local frame at the region holding a
+    /// position
+    void PlaceInRegion(std::size_t index,
+                       const math::WorldCoordinates& position);
+
+    /// @brief Sizes the local frame columns to the store and places every
+    /// entry from the Position() columns
+    void RebuildLocalFrames();
+
+    /// @brief Sets the reference state of every entry from the columns, at
+    /// the motion time
+    void RebuildReferences();
+
+    /// @brief Moves an entry's reference state up to the motion time, so
+    /// its accelerations can change from here on
+    void Rereference(std::size_t index);
+
+    /// @brief Copies an entry over another in every column, updating the
+    /// slot map for the copied entry
+    void MoveEntry(std::size_t from, std::size_t to);
+
+    /// @brief Moves an entry across the group boundaries between two
+    /// groups, where GetGroupCount() stands for the sleeping range
+    /// @return New dense index of the entry
+    std::size_t MoveAcrossGroups(std::size_t index, std::size_t from,
+                                 std::size_t to);
+
+    /// @brief Clears an entry's idle tick count after a setter changed its
+    /// motion, recording a wake if it sleeps
+    void MarkMoved(std::size_t index);
+
+    // Sleeping and groups
+    std::vector<std::uint32_t> mIdleTicks;
+    std::vector<std::uint32_t> mGroups;
+    /// Sleepers changed by a setter, woken by ApplyPendingWakes()
+    std::vector<ParticleHandle> mPendingWakes;
+    /// Start of each group in the dense range; the last entry is the end of
+    /// the awake range
+    std::vector<std::size_t> mGroupStart{0, 0};
+
+    // Scratch columns of Reorder(), one per element type
+    std::vector<ParticleHandle> mReorderHandles;
+    std::vector<double> mReorderDoubles;
+    std::vector<float> mReorderFloats;
+    std::vector<std::uint32_t> mReorderWords;
+};
+
+}  // namespace physics
+}  // namespace solo
+
+#endif  // SOLO_PHYSICS_PARTICLE_STORE_H
@@ -0,0 +1,143 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_PHYSICS_BARNES_HUT_H
+#define SOLO_PHYSICS_BARNES_HUT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "Particle/ParticleStore.h"
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace physics {
+
+/// @brief Parameters of the Barnes-Hut gravity approximation.
+struct BarnesHutSettings {
+    /// Cells whose size over distance is below this are treated as a
+    /// single mass; zero gives exact direct summation
+    double opening_angle{0.5};
+    /// Gravitational constant in m^3 kg^-1 s^-2
+    double gravitational_constant{6.67430e-11};
+    /// Plummer softening length in metres, keeps close encounters finite
+    double softening{1.0e-3};
+};
+
+/// @brief Mutual gravity between particles in O(N log N) using an octree.
+/// Each update sorts the particles by Morton code over their bounding cube,
+/// so every octree cell is a contiguous run of the sorted order. The top
+/// levels of the tree are built serially and each subtree below them is
+/// built on the pool and spliced in. Forces are evaluated per leaf: one
+/// walk collects the cells and bodies acting on every body of the leaf into
+/// a flat list, which each of its bodies then sums in a tight loop.
+class BarnesHut {
+   public:
+    /// @brief Constructs the stage
+    /// @param settings Approximation parameters
+    /// @param resource Source of the scratch memory each update uses; must
+    /// be thread-safe when updates run on a pool
+    explicit BarnesHut(const BarnesHutSettings& settings = {},
+                       std::pmr::memory_resource* resource =
+                           std::pmr::get_default_resource());
+
+    // Prevent copy and assignment
+    BarnesHut(const BarnesHut&) = delete;
+    BarnesHut& operator=(const BarnesHut&) = delete;
+
+    // Prevent move and assignment
+    BarnesHut(BarnesHut&&) = delete;
+    BarnesHut& operator=(BarnesHut&&) = delete;
+
+    const BarnesHutSettings& GetSettings() const { return mSettings; }
+    void SetSettings(const BarnesHutSettings& settings) {
+        mSettings = settings;
+    }
+
+    /// @brief Adds the gravitational acceleration of every particle
+    /// @param store Particles; mass and position are read
+    /// @param acceleration Columns sized to the store, added to
+    /// @param pool Optional pool the build and evaluation are split across
+    void Accumulate(const ParticleStore& store,
+                    VectorColumns<float>& acceleration,
+                    threading::ThreadPool* pool = nullptr);
+
+    /// @brief Number of octree nodes built by the last Accumulate()
+    std::size_t GetNodeCount() const { return mNodes.size(); }
+
+   private:
+    /// @brief Octree cell covering a contiguous run of sorted bodies
+    struct Node {
+        double center_x{0.0};
+        double center_y{0.0};
+        double center_z{0.0};
+        double mass{0.0};
+        double corner_x{0.0};
+        double corner_y{0.0};
+        double corner_z{0.0};
+        /// Edge length of the cell
+        double size{0.0};
+        std::uint32_t first_child{0};
+        std::uint32_t child_count{0};
+        std::uint32_t begin{0};
+        std::uint32_t end{0};
+    };
+
+    /// @brief Body in Morton order
+    struct Body {
+        double x;
+        double y;
+        double z;
+        double mass;
+    };
+
+    /// @brief Subtree left for the pool by the serial top-level build
+    struct Task {
+        std::uint32_t node;
+        std::uint32_t level;
+    };
+
+    void SortBodies(const ParticleStore& store, threading::ThreadPool* pool);
+    void BuildTree(threading::ThreadPool* pool);
+    void Subdivide(std::vector<Node>& nodes, std::uint32_t node,
+                   std::uint32_t level, std::pmr::vector<Task>* tasks) const;
+    void Summarize(Node& node, const std::vector<Node>& nodes) const;
+    /// @brief Accumulates the acceleration of the leaves [begin, end)
+    void Evaluate(std::size_t begin, std::size_t end,
+                  VectorColumns<float>& acceleration) const;
+
+    BarnesHutSettings mSettings;
+    std::pmr::memory_resource* mResource;
+
+    // Bounding cube of the last update
+    double mOriginX{0.0};
+    double mOriginY{0.0};
+    double mOriginZ{0.0};
+    double mExtent{0.0};
+
+    struct SortEntry {
+        std::uint64_t code;
+        std::uint32_t index;
+    };
+    std::vector<SortEntry> mOrder;
+    std::vector<SortEntry> mSortScratch;
+    std::vector<Body> mBodies;
+    std::vector<Node> mNodes;
+    std::vector<std::uint32_t> mLeaves;
+    std::vector<std::vector<Node>> mSubtrees;
+};
+
+}  // namespace physics
+}  // namespace solo
+
+#endif  // SOLO_PHYSICS_BARNES_HUT_H
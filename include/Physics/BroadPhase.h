@@ -0,0 +1,82 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_PHYSICS_BROAD_PHASE_H
+#define SOLO_PHYSICS_BROAD_PHASE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Particle/ParticleHandle.h"
+#include "Particle/ParticleStore.h"
+#include "Physics/SpatialGrid.h"
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace physics {
+
+/// @brief Two particles whose bounding spheres overlap.
+struct CollisionPair {
+    /// Dense indices, valid until the store next changes; first < second
+    std::uint32_t first_index{0};
+    std::uint32_t second_index{0};
+    /// Stable handles of the same particles
+    ParticleHandle first;
+    ParticleHandle second;
+};
+
+/// @brief Finds every pair of particles whose radius spheres overlap.
+/// Particles are bucketed in a SpatialGrid whose cells are as wide as the
+/// median diameter, so a few large particles do not coarsen the grid for
+/// everyone else. Each pair is found by its larger particle, ties going to
+/// the lower dense index, with a query of twice its own radius; the other
+/// particle never looks for it, so every pair is reported exactly once.
+/// The particle range is split into fixed chunks that write their own pair
+/// buffers, and the pairs are sorted once merged, so the result order does
+/// not depend on the thread count. Particles with a zero radius have no
+/// extent and are skipped.
+class BroadPhase {
+   public:
+    BroadPhase() = default;
+
+    // Prevent copy and assignment
+    BroadPhase(const BroadPhase&) = delete;
+    BroadPhase& operator=(const BroadPhase&) = delete;
+
+    // Prevent move and assignment
+    BroadPhase(BroadPhase&&) = delete;
+    BroadPhase& operator=(BroadPhase&&) = delete;
+
+    /// @brief Finds the overlapping pairs of the store
+    /// @param store Particles to test
+    /// @param pool Optional pool the test is split across
+    void Update(const ParticleStore& store,
+                threading::ThreadPool* pool = nullptr);
+
+    /// @brief Pairs found by the last Update(), ordered by first index
+    const std::vector<CollisionPair>& GetPairs() const { return mPairs; }
+
+    /// @brief Cell edge the last Update() bucketed the particles with
+    double GetCellSize() const { return mGrid.GetCellSize(); }
+
+   private:
+    SpatialGrid mGrid;
+    /// Positive radii of the last update, for finding the median
+    std::vector<float> mRadii;
+    std::vector<std::vector<CollisionPair>> mChunkPairs;
+    std::vector<CollisionPair> mPairs;
+};
+
+}  // namespace physics
+}  // namespace solo
+
+#endif  // SOLO_PHYSICS_BROAD_PHASE_H
@@ -0,0 +1,190 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_PHYSICS_EMITTER_REGISTRY_H
+#define SOLO_PHYSICS_EMITTER_REGISTRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Math/Vector.h"
+#include "Particle/ParticleHandle.h"
+#include "Particle/ParticleStore.h"
+
+namespace solo {
+namespace physics {
+
+/// @brief Source of short-lived particles. Each particle starts at a
+/// uniformly random point of a box around the emitter, with a uniformly
+/// random velocity and lifetime around the given means, and is removed
+/// when its lifetime ends.
+struct Emitter {
+    /// Centre of the box particles appear in
+    math::WorldCoordinates position;
+    /// Half extent of that box on each axis
+    math::Vector position_spread;
+    /// Mean initial velocity
+    math::Vector velocity;
+    /// Half width of the spread of each velocity component
+    math::Vector velocity_spread;
+    /// Acceleration every particle starts with
+    math::Vector acceleration;
+    double mass{1.0};
+    float radius{0.0f};
+    std::uint32_t tags{0};
+    /// Particles per second, spread evenly over the ticks
+    double rate{0.0};
+    /// Mean seconds a particle lives
+    double lifetime{1.0};
+    /// Half width of the spread of the lifetime, below lifetime
+    double lifetime_spread{0.0};
+    /// Most particles the emitter keeps alive at once. Room for them is
+    /// reserved when the emitter is added; spawns beyond it are dropped.
+    std::size_t capacity{1024};
+    /// Seed of the emitter's random stream, so runs repeat
+    std::uint64_t seed{1};
+};
+
+/// @brief Identifies an emitter within an EmitterRegistry
+using EmitterId = std::uint32_t;
+
+/// @brief Set of emitters and the lifetimes of the particles they made.
+/// Spawn() adds everything due over a step in one batch per emitter.
+/// Expire() collects every particle whose lifetime has ended in one pass
+/// over the pending lifetimes, and is skipped until the earliest of them
+/// comes due. The store and the registry's own buffers are sized for every
+/// emitter's capacity when it is added, so bursts do not allocate.
+class EmitterRegistry {
+   public:
+    /// @brief End of one particle's lifetime
+    struct Expiry {
+        double time{0.0};
+        ParticleHandle handle;
+        EmitterId emitter{0};
+    };
+
+    EmitterRegistry() = default;
+
+    // Prevent copy and assignment
+    EmitterRegistry(const EmitterRegistry&) = delete;
+    EmitterRegistry& operator=(const EmitterRegistry&) = delete;
+
+    // Prevent move and assignment
+    EmitterRegistry(EmitterRegistry&&) = delete;
+    EmitterRegistry& operator=(EmitterRegistry&&) = delete;
+
+    /// @brief Registers an emitter and reserves room for its particles
+    /// @param emitter Emitter spawning from the next Spawn()
+    /// @param store Store the particles will be added to
+    /// @return Id for Remove() and Burst()
+    /// @throws std::invalid_argument unless the rate is at least zero and
+    /// the lifetime spread is at least zero and below the lifetime
+    EmitterId Add(const Emitter& emitter, ParticleStore& store);
+
+    /// @brief Unregisters an emitter. Its particles live out their
+    /// lifetimes.
+    /// @param id Id returned by Add()
+    /// @return False if no emitter has the id
+    bool Remove(EmitterId id);
+
+    /// @brief Looks up a registered emitter
+    /// @param id Id returned by Add()
+    /// @return Emitter, or nullptr if no emitter has the id
+    const Emitter* Find(EmitterId id) const;
+
+    /// @brief Queues particles to spawn in one go on the next Spawn(), on
+    /// top of the emitter's rate
+    /// @param id Id returned by Add()
+    /// @param count Particles to spawn
+    /// @return False if no emitter has the id
+    bool Burst(EmitterId id, std::size_t count);
+
+    /// @brief Collects the particles whose lifetime has ended by the
+    /// registry's clock. Particles removed in the meantime may be among
+    /// them.
+    /// @return Their handles, valid until the next call
+    const std::vector<ParticleHandle>& Expire();
+
+    /// @brief Spawns everything due over a step, then moves the clock on
+    /// by it
+    /// @param store Store to add the particles to
+    /// @param time_step Seconds covered by the step
+    /// @return Number of particles added; they are the last entries of the
+    /// store's first group
+    std::size_t Spawn(ParticleStore& store, double time_step);
+
+    /// @brief Lifetimes not yet ended, in no particular order
+    const std::vector<Expiry>& GetExpiries() const { return mExpiries; }
+
+    /// @brief Replaces the pending lifetimes and the clock, as when the
+    /// store has been replaced by a checkpoint. Each emitter's live count
+    /// becomes the number of lifetimes it holds; lifetimes of emitters not
+    /// registered still end on time.
+    /// @param expiries Lifetimes not yet ended
+    /// @param time Registry clock they were saved at
+    void RestoreLifetimes(const std::vector<Expiry>& expiries, double time);
+
+    /// @brief Particles of an emitter still alive
+    /// @param id Id returned by Add()
+    /// @return Count, or zero if no emitter has the id
+    std::size_t GetLiveCount(EmitterId id) const;
+
+    /// @brief Spawns dropped so far because an emitter was full
+    std::uint64_t GetDroppedCount() const { return mDropped; }
+
+    /// @brief Seconds the registry has been stepped through
+    double GetTime() const { return mTime; }
+
+    /// @brief Number of registered emitters
+    std::size_t size() const { return mEntries.size(); }
+
+    /// @brief True when no emitters are registered
+    bool empty() const { return mEntries.empty(); }
+
+   private:
+    /// @brief Emitter with its spawning state
+    struct Entry {
+        Emitter emitter;
+        EmitterId id{0};
+        /// Fraction of a particle the rate has built up
+        double carry{0.0};
+        /// Burst particles waiting for the next Spawn()
+        std::size_t pending{0};
+        std::size_t live{0};
+        std::uint64_t random{0};
+    };
+
+    /// @brief Registered emitter by id, or nullptr
+    Entry* FindEntry(EmitterId id);
+    const Entry* FindEntry(EmitterId id) const;
+
+    /// @brief Adds count particles of one emitter to the store
+    void SpawnBatch(Entry& entry, ParticleStore& store, std::size_t count);
+
+    std::vector<Entry> mEntries;
+    EmitterId mNextId{0};
+    std::vector<Expiry> mExpiries;
+    /// Earliest time in mExpiries
+    double mNextExpiry{std::numeric_limits<double>::infinity()};
+    std::vector<ParticleHandle> mExpired;
+    /// Particles every emitter may hold together
+    std::size_t mCapacity{0};
+    double mTime{0.0};
+    std::uint64_t mDropped{0};
+};
+
+}  // namespace physics
+}  // namespace solo
+
+#endif  // SOLO_PHYSICS_EMITTER_REGISTRY_H
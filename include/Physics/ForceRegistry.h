@@ -0,0 +1,149 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_PHYSICS_FORCE_REGISTRY_H
+#define SOLO_PHYSICS_FORCE_REGISTRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Math/Vector.h"
+#include "Particle/ParticleStore.h"
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace physics {
+
+/// @brief Kinds of force a ForceGenerator can apply.
+enum class ForceType : std::uint8_t {
+    /// Constant acceleration, independent of mass
+    Uniform,
+    /// Quadratic drag relative to a uniformly moving fluid
+    Drag,
+};
+
+/// @brief Description of an environmental force applied to every particle
+/// whose tags it selects. Generators are plain data so the registry can
+/// evaluate all of them in one sweep without virtual calls per particle.
+struct ForceGenerator {
+    /// @brief Tag mask selecting every particle, tagged or not
+    static constexpr std::uint32_t ALL_PARTICLES{0};
+
+    ForceType type{ForceType::Uniform};
+    /// Acceleration for Uniform, velocity of the fluid for Drag
+    math::Vector vector;
+    /// Drag force per squared unit of relative speed
+    float coefficient{0.0f};
+    /// Selects particles sharing at least one tag bit with the mask
+    std::uint32_t tags{ALL_PARTICLES};
+
+    /// @brief Constant gravitational acceleration
+    /// @param acceleration Acceleration applied to every selected particle
+    /// @param tags Particles to target
+    static ForceGenerator Gravity(const math::Vector& acceleration,
+                                  std::uint32_t tags = ALL_PARTICLES);
+
+    /// @brief Quadratic drag through still air or water
+    /// @param coefficient Force per squared unit of speed
+    /// @param tags Particles to target
+    static ForceGenerator Drag(float coefficient,
+                               std::uint32_t tags = ALL_PARTICLES);
+
+    /// @brief Quadratic drag relative to a steady wind
+    /// @param velocity Velocity of the air
+    /// @param coefficient Force per squared unit of relative speed
+    /// @param tags Particles to target
+    static ForceGenerator Wind(const math::Vector& velocity, float coefficient,
+                               std::uint32_t tags = ALL_PARTICLES);
+
+    /// @brief Quadratic drag relative to a steady water current
+    /// @param velocity Velocity of the water
+    /// @param coefficient Force per squared unit of relative speed
+    /// @param tags Particles to target, typically vessels
+    static ForceGenerator Current(const math::Vector& velocity,
+                                  float coefficient,
+                                  std::uint32_t tags = ALL_PARTICLES);
+};
+
+/// @brief Identifies a generator within a ForceRegistry
+using ForceGeneratorId = std::uint32_t;
+
+/// @brief Set of force generators evaluated together.
+/// Apply() walks the store once in small blocks; every generator runs over
+/// a block while it is still in cache, so adding a generator costs
+/// arithmetic rather than another pass over memory. Each block is written
+/// by exactly one task, so results do not depend on the thread count.
+class ForceRegistry {
+   public:
+    ForceRegistry() = default;
+
+    // Prevent copy and assignment
+    ForceRegistry(const ForceRegistry&) = delete;
+    ForceRegistry& operator=(const ForceRegistry&) = delete;
+
+    // Prevent move and assignment
+    ForceRegistry(ForceRegistry&&) = delete;
+    ForceRegistry& operator=(ForceRegistry&&) = delete;
+
+    /// @brief Registers a generator
+    /// @param generator Force to apply from the next Apply()
+    /// @return Id for Remove()
+    ForceGeneratorId Add(const ForceGenerator& generator);
+
+    /// @brief Unregisters a generator
+    /// @param id Id returned by Add()
+    /// @return False if no generator has the id
+    bool Remove(ForceGeneratorId id);
+
+    /// @brief Looks up a registered generator
+    /// @param id Id returned by Add()
+    /// @return Generator, or nullptr if no generator has the id
+    const ForceGenerator* Find(ForceGeneratorId id) const;
+
+    /// @brief Unregisters every generator
+    void Clear();
+
+    /// @brief Number of registered generators
+    std::size_t size() const { return mGenerators.size(); }
+
+    /// @brief True when no generators are registered
+    bool empty() const { return mGenerators.empty(); }
+
+    /// @brief Writes each awake particle's own acceleration plus the
+    /// acceleration of every generator that selects it
+    /// @param store Particles to evaluate
+    /// @param acceleration Output columns, resized to the store; entries of
+    /// sleeping particles are left as they were
+    /// @param pool Optional pool the sweep is split across
+    void Apply(const ParticleStore& store, VectorColumns<float>& acceleration,
+               threading::ThreadPool* pool = nullptr) const;
+
+    /// @brief As Apply(), for the dense range [begin, end) only
+    void Apply(const ParticleStore& store, std::size_t begin,
+               std::size_t end, VectorColumns<float>& acceleration,
+               threading::ThreadPool* pool = nullptr) const;
+
+   private:
+    /// @brief Evaluates the dense range [begin, end) block by block
+    void ApplyRange(const ParticleStore& store,
+                    VectorColumns<float>& acceleration, std::size_t begin,
+                    std::size_t end) const;
+
+    std::vector<ForceGenerator> mGenerators;
+    std::vector<ForceGeneratorId> mIds;
+    ForceGeneratorId mNextId{0};
+};
+
+}  // namespace physics
+}  // namespace solo
+
+#endif  // SOLO_PHYSICS_FORCE_REGISTRY_H
@@ -0,0 +1,100 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_PHYSICS_INTEGRATORS_H
+#define SOLO_PHYSICS_INTEGRATORS_H
+
+#include <cstdint>
+
+namespace solo {
+namespace physics {
+
+// Integrator policies for the update kernels. Each advances one component
+// of a position, velocity pair over a step given the acceleration
+// evaluated at the start of the step and the one used by the previous
+// step. The kernels are instantiated per policy, so the choice costs no
+// branch in the loop.
+
+/// @brief Selects an integrator policy at run time, e.g. per engine.
+enum class IntegratorType : std::uint8_t {
+    SymplecticEuler,
+    VelocityVerlet,
+    RungeKutta4,
+};
+
+/// @brief Semi-implicit Euler: the velocity is kicked first and the
+/// position drifts with the new velocity. First order but symplectic, so
+/// orbits and oscillators keep their energy over long runs.
+struct SymplecticEuler {
+    /// True when the policy reads the previous acceleration
+    static constexpr bool USES_HISTORY{false};
+
+    template <typename Position>
+    static void Step(Position& position, float& velocity, float acceleration,
+                     float /*previous*/, float step) {
+        velocity += acceleration * step;
+        position += static_cast<Position>(velocity * step);
+    }
+};
+
+/// @brief Velocity Verlet with one force evaluation per step.
+/// The stored velocity ends each step with its closing half kick predicted
+/// from the step's own acceleration; the next step replaces that guess
+/// with the half kick of the acceleration it evaluates. Positions are
+/// second order and the velocity stays in step with them.
+struct VelocityVerlet {
+    static constexpr bool USES_HISTORY{true};
+
+    template <typename Position>
+    static void Step(Position& position, float& velocity, float acceleration,
+                     float previous, float step) {
+        const float half_step = 0.5f * step;
+        // Correct the predicted closing kick of the previous step
+        velocity += (acceleration - previous) * half_step;
+        // Opening kick, drift, predicted closing kick
+        velocity += acceleration * half_step;
+        position += static_cast<Position>(velocity * step);
+        velocity += acceleration * half_step;
+    }
+};
+
+/// @brief Classic four-stage Runge-Kutta. With one force evaluation per
+/// step the stages cannot re-evaluate the forces, so the acceleration is
+/// extrapolated linearly across the step from the previous one; that model
+/// is integrated exactly, giving third order positions for smooth forces.
+struct RungeKutta4 {
+    static constexpr bool USES_HISTORY{true};
+
+    template <typename Position>
+    static void Step(Position& position, float& velocity, float acceleration,
+                     float previous, float step) {
+        const float half_step = 0.5f * step;
+        // Acceleration at the start, middle and end of the step
+        const float jerk_step = acceleration - previous;
+        const float a1 = acceleration;
+        const float a2 = acceleration + 0.5f * jerk_step;
+        const float a4 = acceleration + jerk_step;
+
+        const float v1 = velocity;
+        const float v2 = velocity + a1 * half_step;
+        const float v3 = velocity + a2 * half_step;
+        const float v4 = velocity + a2 * step;
+
+        position += static_cast<Position>((v1 + 2.0f * (v2 + v3) + v4) *
+                                          (step / 6.0f));
+        velocity += (a1 + 4.0f * a2 + a4) * (step / 6.0f);
+    }
+};
+
+}  // namespace physics
+}  // namespace solo
+
+#endif  // SOLO_PHYSICS_INTEGRATORS_H
@@ -0,0 +1,148 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_PHYSICS_MORTON_H
+#define SOLO_PHYSICS_MORTON_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "Particle/ParticleStore.h"
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace physics {
+
+/// @brief Bits per axis of a 3D Morton code
+constexpr std::uint32_t MORTON_BITS{21};
+
+/// @brief Spreads the low 21 bits of value so two zero bits follow each
+inline std::uint64_t SpreadMortonBits(std::uint64_t value) {
+    value &= 0x1FFFFF;
+    value = (value | value << 32) & 0x1F00000000FFFFULL;
+    value = (value | value << 16) & 0x1F0000FF0000FFULL;
+    value = (value | value << 8) & 0x100F00F00F00F00FULL;
+    value = (value | value << 4) & 0x10C30C30C30C30C3ULL;
+    value = (value | value << 2) & 0x1249249249249249ULL;
+    return value;
+}
+
+/// @brief Interleaves three 21-bit cell coordinates, x in the highest bit
+/// of each triple, so sorting by code walks a Z-order curve.
+inline std::uint64_t EncodeMorton(std::uint32_t x, std::uint32_t y,
+                                  std::uint32_t z) {
+    return SpreadMortonBits(x) << 2 | SpreadMortonBits(y) << 1 |
+           SpreadMortonBits(z);
+}
+
+/// @brief Morton code of a position inside a cube
+/// @param x Position relative to the cube's lowest corner
+/// @param y Position relative to the cube's lowest corner
+/// @param z Position relative to the cube's lowest corner
+/// @param scale Cells per unit length, 2^21 over the cube edge
+inline std::uint64_t EncodeMorton(double x, double y, double z,
+                                  double scale) {
+    const double last_cell = (1u << MORTON_BITS) - 1;
+    const auto quantise = [scale, last_cell](double value) {
+        return static_cast<std::uint32_t>(
+            std::clamp(value * scale, 0.0, last_cell));
+    };
+    return EncodeMorton(quantise(x), quantise(y), quantise(z));
+}
+
+/// @brief Axis-aligned bounds of a set of positions
+struct PositionBounds {
+    double min_x{std::numeric_limits<double>::max()};
+    double min_y{std::numeric_limits<double>::max()};
+    double min_z{std::numeric_limits<double>::max()};
+    double max_x{std::numeric_limits<double>::lowest()};
+    double max_y{std::numeric_limits<double>::lowest()};
+    double max_z{std::numeric_limits<double>::lowest()};
+
+    /// @brief Grows the bounds to hold a position
+    void Extend(double x, double y, double z) {
+        min_x = std::min(min_x, x);
+        min_y = std::min(min_y, y);
+        min_z = std::min(min_z, z);
+        max_x = std::max(max_x, x);
+        max_y = std::max(max_y, y);
+        max_z = std::max(max_z, z);
+    }
+
+    /// @brief Grows the bounds to hold other bounds
+    void Extend(const PositionBounds& other) {
+        Extend(other.min_x, other.min_y, other.min_z);
+        Extend(other.max_x, other.max_y, other.max_z);
+    }
+};
+
+/// @brief Cube the Morton codes of a set of positions are taken in
+struct MortonCube {
+    /// Lowest corner
+    double origin_x{0.0};
+    double origin_y{0.0};
+    double origin_z{0.0};
+    /// Edge length, never zero
+    double extent{1.0};
+
+    /// @brief Cells per unit length for codes of the given bits per axis
+    double Scale(std::uint32_t bits) const {
+        return static_cast<double>(std::uint32_t{1} << bits) / extent;
+    }
+};
+
+/// @brief Smallest cube around every position in a store, padded so the
+/// largest coordinate stays inside the last cell.
+/// @param store Particles whose positions are bounded; must not be empty
+/// @param chunk_bounds Scratch for one box per chunk, kept between calls
+/// @param pool Pool the reduction is spread over; may be null
+/// @param chunk_size Positions per pool chunk
+/// @return Cube at the lowest corner of the bounds
+template <typename Allocator>
+MortonCube ComputeMortonCube(
+    const ParticleStore& store,
+    std::vector<PositionBounds, Allocator>& chunk_bounds,
+    threading::ThreadPool* pool, std::size_t chunk_size) {
+    const std::size_t count = store.size();
+    const VectorColumns<double>& position = store.Position();
+
+    chunk_bounds.assign((count + chunk_size - 1) / chunk_size,
+                        PositionBounds{});
+    threading::ParallelFor(
+        pool, count, chunk_size, [&](std::size_t begin, std::size_t end) {
+            PositionBounds& bounds = chunk_bounds[begin / chunk_size];
+            for (std::size_t i = begin; i < end; ++i) {
+                bounds.Extend(position.x[i], position.y[i], position.z[i]);
+            }
+        });
+    PositionBounds bounds;
+    for (const PositionBounds& chunk : chunk_bounds) {
+        bounds.Extend(chunk);
+    }
+
+    MortonCube cube;
+    cube.origin_x = bounds.min_x;
+    cube.origin_y = bounds.min_y;
+    cube.origin_z = bounds.min_z;
+    const double extent = std::max({bounds.max_x - bounds.min_x,
+                                    bounds.max_y - bounds.min_y,
+                                    bounds.max_z - bounds.min_z});
+    cube.extent = extent > 0.0 ? extent * (1.0 + 1.0e-9) : 1.0;
+    return cube;
+}
+
+}  // namespace physics
+}  // namespace solo
+
+#endif  // SOLO_PHYSICS_MORTON_H
@@ -0,0 +1,117 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_PHYSICS_RADIX_SORT_H
+#define SOLO_PHYSICS_RADIX_SORT_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace physics {
+
+/// Key bits sorted per pass
+constexpr std::size_t RADIX_DIGIT_BITS{11};
+
+/// @brief Count of each digit value within one chunk of items
+using RadixCounts = std::array<std::size_t, std::size_t{1} << RADIX_DIGIT_BITS>;
+
+/// @brief Stable LSD radix sort of items by an unsigned integer key.
+/// Sorts 11 bits per pass, so a pass streams through the items once to
+/// count and once to scatter regardless of how large the key range is.
+/// @param items Items to sort; sorted in place
+/// @param scratch Buffer reused between calls, resized to items.size()
+/// @param key Callable returning the std::uint64_t key of an item
+/// @param key_bits Number of low key bits that can be set
+template <typename T, typename Key>
+void RadixSort(std::vector<T>& items, std::vector<T>& scratch, Key&& key,
+               std::size_t key_bits) {
+    constexpr std::uint64_t kDigitMask = RadixCounts{}.size() - 1;
+
+    scratch.resize(items.size());
+    for (std::size_t shift = 0; shift < key_bits; shift += RADIX_DIGIT_BITS) {
+        RadixCounts offsets{};
+        for (const T& item : items) {
+            ++offsets[(key(item) >> shift) & kDigitMask];
+        }
+
+        std::size_t total = 0;
+        for (std::size_t& offset : offsets) {
+            total += std::exchange(offset, total);
+        }
+        for (const T& item : items) {
+            scratch[offsets[(key(item) >> shift) & kDigitMask]++] = item;
+        }
+        items.swap(scratch);
+    }
+}
+
+/// @brief Parallel form of RadixSort(). Each pass counts digits per chunk
+/// of items, then every chunk scatters its items past those with the same
+/// digit in earlier chunks, so the sort stays stable.
+/// @param items Items to sort; sorted in place
+/// @param scratch Buffer reused between calls, resized to items.size()
+/// @param key Callable returning the std::uint64_t key of an item
+/// @param key_bits Number of low key bits that can be set
+/// @param offsets Per-chunk digit counts reused between calls, resized to
+/// the chunk count
+/// @param pool Pool to run on, or nullptr for the calling thread
+/// @param grain Items per chunk; at least 1
+template <typename T, typename Key>
+void RadixSort(std::vector<T>& items, std::vector<T>& scratch, Key&& key,
+               std::size_t key_bits, std::vector<RadixCounts>& offsets,
+               threading::ThreadPool* pool, std::size_t grain) {
+    constexpr std::size_t kDigitCount = RadixCounts{}.size();
+    constexpr std::uint64_t kDigitMask = kDigitCount - 1;
+
+    scratch.resize(items.size());
+    offsets.resize((items.size() + grain - 1) / grain);
+    for (std::size_t shift = 0; shift < key_bits; shift += RADIX_DIGIT_BITS) {
+        threading::ParallelFor(
+            pool, items.size(), grain,
+            [&](std::size_t begin, std::size_t end) {
+                RadixCounts& counts = offsets[begin / grain];
+                counts.fill(0);
+                for (std::size_t i = begin; i < end; ++i) {
+                    ++counts[(key(items[i]) >> shift) & kDigitMask];
+                }
+            });
+
+        // Digit-major prefix sum: all of digit d, chunk by chunk, before d+1.
+        std::size_t total = 0;
+        for (std::size_t digit = 0; digit < kDigitCount; ++digit) {
+            for (RadixCounts& counts : offsets) {
+                total += std::exchange(counts[digit], total);
+            }
+        }
+
+        threading::ParallelFor(
+            pool, items.size(), grain,
+            [&](std::size_t begin, std::size_t end) {
+                RadixCounts& next = offsets[begin / grain];
+                for (std::size_t i = begin; i < end; ++i) {
+                    scratch[next[(key(items[i]) >> shift) & kDigitMask]++] =
+                        items[i];
+                }
+            });
+        items.swap(scratch);
+    }
+}
+
+}  // namespace physics
+}  // namespace solo
+
+#endif  // SOLO_PHYSICS_RADIX_SORT_H
@@ -0,0 +1,241 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_PHYSICS_SPATIAL_GRID_H
+#define SOLO_PHYSICS_SPATIAL_GRID_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Particle/ParticleStore.h"
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace physics {
+
+/// @brief Integer coordinates of a grid cell
+struct GridCell {
+    std::int64_t x{0};
+    std::int64_t y{0};
+    std::int64_t z{0};
+
+    bool operator==(const GridCell& value) const = default;
+};
+
+/// @brief Result of a nearest neighbour query
+struct Neighbour {
+    /// Dense index into the store the grid was built from
+    std::size_t index{0};
+    double distance_squared{0.0};
+};
+
+/// @brief Hashed uniform grid over particle positions.
+/// Space is cut into cubic cells which are hashed into a bucket table of at
+/// least twice the particle count, so memory follows the particle count and
+/// not the extent of the world. Build() radix sorts the particles by
+/// bucket and keeps a copy of their positions in that order, so a query
+/// walks contiguous memory. Queries are const and may run concurrently from
+/// any number of threads between builds. Results are dense indices into the
+/// store the grid was last built from.
+class SpatialGrid {
+   public:
+    /// @brief Constructs an empty grid
+    /// @param cell_size Edge length of a cell; about the typical query
+    /// radius works best. Throws std::invalid_argument unless positive and
+    /// finite.
+    explicit SpatialGrid(double cell_size = 1.0);
+
+    /// @brief Changes the cell size. Takes effect at the next Build().
+    /// Throws std::invalid_argument unless positive and finite.
+    void SetCellSize(double cell_size);
+
+    /// @brief Edge length of a cell
+    double GetCellSize() const { return mCellSize; }
+
+    /// @brief Number of particles indexed by the last build
+    std::size_t size() const { return mEntries.size(); }
+
+    /// @brief Reindexes every particle of the store
+    /// @param store Particles to index
+    /// @param pool Optional pool used to hash positions in parallel
+    void Build(const ParticleStore& store,
+               threading::ThreadPool* pool = nullptr);
+
+    /// @brief Cell containing a position
+    GridCell CellOf(double x, double y, double z) const {
+        return {static_cast<std::int64_t>(std::floor(x * mInverseCellSize)),
+                static_cast<std::int64_t>(std::floor(y * mInverseCellSize)),
+                static_cast<std::int64_t>(std::floor(z * mInverseCellSize))};
+    }
+
+    /// @brief Calls function(index, distance_squared) for every particle
+    /// within radius of center, in no particular order
+    template <typename Function>
+    void ForEachInRadius(const math::WorldCoordinates& center, double radius,
+                         Function&& function) const {
+        const double cx = center.GetX();
+        const double cy = center.GetY();
+        const double cz = center.GetZ();
+        const double radius_squared = radius * radius;
+
+        ForEachCandidate(CellOf(cx - radius, cy - radius, cz - radius),
+                         CellOf(cx + radius, cy + radius, cz + radius),
+                         [&](std::size_t entry) {
+                             const Point& point = mPoints[entry];
+                             const double dx = point.x - cx;
+                             const double dy = point.y - cy;
+                             const double dz = point.z - cz;
+                             const double distance_squared =
+                                 dx * dx + dy * dy + dz * dz;
+                             if (distance_squared <= radius_squared) {
+                                 function(std::size_t{mEntries[entry]},
+                                          distance_squared);
+                             }
+                         });
+    }
+
+    /// @brief Calls function(index) for every particle inside the
+    /// axis-aligned box [minimum, maximum], in no particular order
+    template <typename Function>
+    void ForEachInBox(const math::WorldCoordinates& minimum,
+                      const math::WorldCoordinates& maximum,
+                      Function&& function) const {
+        const double lx = minimum.GetX();
+        const double ly = minimum.GetY();
+        const double lz = minimum.GetZ();
+        const double hx = maximum.GetX();
+        const double hy = maximum.GetY();
+        const double hz = maximum.GetZ();
+
+        ForEachCandidate(CellOf(lx, ly, lz), CellOf(hx, hy, hz),
+                         [&](std::size_t entry) {
+                             const double x = mPoints[entry].x;
+                             const double y = mPoints[entry].y;
+                             const double z = mPoints[entry].z;
+                             if (x >= lx && x <= hx && y >= ly && y <= hy &&
+                                 z >= lz && z <= hz) {
+                                 function(std::size_t{mEntries[entry]});
+                             }
+                         });
+    }
+
+    /// @brief Finds every particle within radius of center
+    /// @param center Query point
+    /// @param radius Search radius
+    /// @param result Cleared, then filled with dense indices
+    void QueryRadius(const math::WorldCoordinates& center, double radius,
+                     std::vector<std::size_t>& result) const;
+
+    /// @brief Finds every particle inside an axis-aligned box
+    /// @param minimum Lowest corner of the box
+    /// @param maximum Highest corner of the box
+    /// @param result Cleared, then filled with dense indices
+    void QueryBox(const math::WorldCoordinates& minimum,
+                  const math::WorldCoordinates& maximum,
+                  std::vector<std::size_t>& result) const;
+
+    /// @brief Finds the k particles closest to center
+    /// @param center Query point
+    /// @param count Number of neighbours wanted
+    /// @param result Cleared, then filled with at most count neighbours,
+    /// closest first
+    void QueryNearest(const math::WorldCoordinates& center, std::size_t count,
+                      std::vector<Neighbour>& result) const;
+
+   private:
+    /// @brief Position of an entry. Interleaved, unlike the store, since a
+    /// query reads all three components of every candidate.
+    struct Point {
+        double x;
+        double y;
+        double z;
+    };
+
+    /// @brief Bucket a cell hashes to. Only y and z are mixed, so the
+    /// cells of an x row land in consecutive buckets and a query walks
+    /// each row of its cell range through contiguous memory.
+    std::size_t BucketOf(const GridCell& cell) const {
+        std::uint64_t hash =
+            static_cast<std::uint64_t>(cell.y) * 0x9E3779B97F4A7C15ULL ^
+            static_cast<std::uint64_t>(cell.z) * 0xC2B2AE3D27D4EB4FULL;
+        hash ^= hash >> 29;
+        return static_cast<std::size_t>(hash +
+                                        static_cast<std::uint64_t>(cell.x)) &
+               mBucketMask;
+    }
+
+    /// @brief Calls function(entry) for every entry of one cell
+    template <typename Function>
+    void ForEachInCell(const GridCell& cell, Function& function) const {
+        const std::size_t bucket = BucketOf(cell);
+        for (std::size_t entry = mBucketStart[bucket];
+             entry < mBucketStart[bucket + 1]; ++entry) {
+            // Other cells share the bucket when their hashes collide.
+            const Point& point = mPoints[entry];
+            if (CellOf(point.x, point.y, point.z) == cell) {
+                function(entry);
+            }
+        }
+    }
+
+    /// @brief Calls function(entry) for every entry in the cell range
+    /// [low, high], falling back to a linear scan when the range covers
+    /// more cells than there are particles
+    template <typename Function>
+    void ForEachCandidate(const GridCell& low, const GridCell& high,
+                          Function&& function) const {
+        if (mEntries.empty() || low.x > high.x || low.y > high.y ||
+            low.z > high.z) {
+            return;
+        }
+
+        const double cells = static_cast<double>(high.x - low.x + 1) *
+                             static_cast<double>(high.y - low.y + 1) *
+                             static_cast<double>(high.z - low.z + 1);
+        if (cells > static_cast<double>(mEntries.size())) {
+            for (std::size_t entry = 0; entry < mEntries.size(); ++entry) {
+                function(entry);
+            }
+            return;
+        }
+
+        GridCell cell;
+        for (cell.z = low.z; cell.z <= high.z; ++cell.z) {
+            for (cell.y = low.y; cell.y <= high.y; ++cell.y) {
+                for (cell.x = low.x; cell.x <= high.x; ++cell.x) {
+                    ForEachInCell(cell, function);
+                }
+            }
+        }
+    }
+
+    double mCellSize{1.0};
+    double mInverseCellSize{1.0};
+    std::size_t mBucketMask{0};
+
+    // Entries sorted by bucket; bucket b holds [start[b], start[b + 1]).
+    std::vector<std::uint32_t> mBucketStart;
+    std::vector<std::uint32_t> mEntries;
+    std::vector<Point> mPoints;
+
+    // Sort keys and scratch, reused between builds
+    std::vector<std::uint64_t> mKeys;
+    std::vector<std::uint64_t> mSortScratch;
+};
+
+}  // namespace physics
+}  // namespace solo
+
+#endif  // SOLO_PHYSICS_SPATIAL_GRID_H
@@ -0,0 +1,171 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_THREADING_BOUNDED_QUEUE_H
+#define SOLO_THREADING_BOUNDED_QUEUE_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace solo {
+namespace threading {
+
+/// @brief Threads allowed to dequeue from a BoundedQueue
+enum class QueueConsumers : uint8_t {
+    /// One consumer thread; a pop never touches shared counters
+    Single,
+    /// Any thread; the dequeue position is claimed by compare and swap
+    Multiple
+};
+
+/// @brief Bounded lock-free multi-producer queue.
+/// Every cell carries a sequence number telling producers and consumers
+/// whose turn it is, so a push is one compare and swap on the enqueue
+/// position plus a release store. Storage is allocated once up front.
+/// Use it through MpscQueue or MpmcQueue.
+/// @tparam T Element type
+/// @tparam Consumers Threads allowed to pop
+template <typename T, QueueConsumers Consumers>
+class BoundedQueue {
+   public:
+    /// @brief Constructs the queue
+    /// @param capacity Minimum number of elements, rounded up to a power of
+    /// two
+    explicit BoundedQueue(std::size_t capacity)
+        : mCapacity(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity)),
+          mMask(mCapacity - 1),
+          mCells(std::make_unique<Cell[]>(mCapacity)) {
+        for (std::size_t i = 0; i < mCapacity; ++i) {
+            mCells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Prevent copy and assignment
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    // Prevent move and assignment
+    BoundedQueue(BoundedQueue&&) = delete;
+    BoundedQueue& operator=(BoundedQueue&&) = delete;
+
+    ~BoundedQueue() = default;
+
+    /// @brief Enqueues a value. Safe from any number of threads.
+    /// @param value Value to copy in
+    /// @return False when the queue is full
+    bool TryPush(const T& value) {
+        std::size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+
+        while (true) {
+            Cell& cell = mCells[position & mMask];
+            const std::size_t sequence =
+                cell.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::intptr_t>(sequence) -
+                                    static_cast<std::intptr_t>(position);
+
+            if (difference == 0) {
+                if (mEnqueuePosition.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.sequence.store(position + 1,
+                                        std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = mEnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// @brief Dequeues a value. Consumer thread only with
+    /// QueueConsumers::Single, any thread with QueueConsumers::Multiple.
+    /// @param value Receives the dequeued value
+    /// @return False when the queue is empty
+    bool TryPop(T& value) {
+        if constexpr (Consumers == QueueConsumers::Single) {
+            return TryPopSingle(value);
+        } else {
+            return TryPopMultiple(value);
+        }
+    }
+
+    /// @brief Maximum number of queued elements
+    std::size_t Capacity() const { return mCapacity; }
+
+   private:
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+
+    /// @brief Pops with the dequeue position owned by the caller
+    bool TryPopSingle(T& value) {
+        const std::size_t position =
+            mDequeuePosition.load(std::memory_order_relaxed);
+        Cell& cell = mCells[position & mMask];
+        const std::size_t sequence =
+            cell.sequence.load(std::memory_order_acquire);
+
+        if (sequence != position + 1) {
+            return false;
+        }
+
+        value = std::move(cell.value);
+        cell.sequence.store(position + mCapacity, std::memory_order_release);
+        mDequeuePosition.store(position + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /// @brief Pops with the dequeue position claimed by compare and swap
+    bool TryPopMultiple(T& value) {
+        std::size_t position = mDequeuePosition.load(std::memory_order_relaxed);
+
+        while (true) {
+            Cell& cell = mCells[position & mMask];
+            const std::size_t sequence =
+                cell.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::intptr_t>(sequence) -
+                                    static_cast<std::intptr_t>(position + 1);
+
+            if (difference == 0) {
+                if (mDequeuePosition.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell.value);
+                    cell.sequence.store(position + mCapacity,
+                                        std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = mDequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::size_t mCapacity;
+    std::size_t mMask;
+    std::unique_ptr<Cell[]> mCells;
+
+    alignas(64) std::atomic<std::size_t> mEnqueuePosition{0};
+    alignas(64) std::atomic<std::size_t> mDequeuePosition{0};
+};
+
+}  // namespace threading
+}  // namespace solo
+
+#endif  // SOLO_THREADING_BOUNDED_QUEUE_H
@@ -0,0 +1,27 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_THREADING_MPSC_QUEUE_H
+#define SOLO_THREADING_MPSC_QUEUE_H
+
+#include "Threading/BoundedQueue.h"
+
+namespace solo {
+namespace threading {
+
+/// @brief Bounded lock-free multi-producer single-consumer queue.
+template <typename T>
+using MpscQueue = BoundedQueue<T, QueueConsumers::Single>;
+
+}  // namespace threading
+}  // namespace solo
+
+#endif  // SOLO_THREADING_MPSC_QUEUE_H
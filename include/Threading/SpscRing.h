@@ -0,0 +1,125 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_THREADING_SPSC_RING_H
+#define SOLO_THREADING_SPSC_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace solo {
+namespace threading {
+
+/// @brief Bounded lock-free single-producer single-consumer ring of
+/// trivially copyable elements. Both sides work on contiguous spans of the
+/// storage, so bulk data is written and read in place without a per
+/// element handshake; each side publishes its progress with one release
+/// store and caches the other side's index to avoid sharing cache lines on
+/// every call. Storage is allocated once up front.
+template <typename T>
+class SpscRing {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Elements are handed over as raw storage");
+
+   public:
+    /// @brief Constructs the ring
+    /// @param capacity Minimum number of elements, rounded up to a power of
+    /// two
+    explicit SpscRing(std::size_t capacity)
+        : mCapacity(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity)),
+          mMask(mCapacity - 1),
+          mData(std::make_unique<T[]>(mCapacity)) {}
+
+    // Prevent copy and assignment
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Prevent move and assignment
+    SpscRing(SpscRing&&) = delete;
+    SpscRing& operator=(SpscRing&&) = delete;
+
+    ~SpscRing() = default;
+
+    /// @brief Free elements. Producer thread only.
+    std::size_t GetFreeCount() {
+        mCachedRead = mRead.load(std::memory_order_acquire);
+        return mCapacity - (mWrite.load(std::memory_order_relaxed) -
+                            mCachedRead);
+    }
+
+    /// @brief Contiguous free storage to write into. Producer thread only.
+    /// Shorter than asked when the ring is nearly full or the free space
+    /// wraps; empty when the ring is full.
+    /// @param count Elements wanted
+    std::span<T> BeginWrite(std::size_t count) {
+        const std::size_t write = mWrite.load(std::memory_order_relaxed);
+        if (mCapacity - (write - mCachedRead) < count) {
+            mCachedRead = mRead.load(std::memory_order_acquire);
+        }
+        const std::size_t offset = write & mMask;
+        const std::size_t available =
+            std::min({count, mCapacity - (write - mCachedRead),
+                      mCapacity - offset});
+        return {mData.get() + offset, available};
+    }
+
+    /// @brief Publishes the first elements of the last BeginWrite() span.
+    /// Producer thread only.
+    void CommitWrite(std::size_t count) {
+        mWrite.store(mWrite.load(std::memory_order_relaxed) + count,
+                     std::memory_order_release);
+    }
+
+    /// @brief Contiguous published elements, up to where the ring wraps.
+    /// Consumer thread only; empty when nothing is waiting.
+    std::span<const T> BeginRead() {
+        const std::size_t read = mRead.load(std::memory_order_relaxed);
+        if (mCachedWrite == read) {
+            mCachedWrite = mWrite.load(std::memory_order_acquire);
+        }
+        const std::size_t offset = read & mMask;
+        return {mData.get() + offset,
+                std::min(mCachedWrite - read, mCapacity - offset)};
+    }
+
+    /// @brief Frees the first elements of the last BeginRead() span.
+    /// Consumer thread only.
+    void CommitRead(std::size_t count) {
+        mRead.store(mRead.load(std::memory_order_relaxed) + count,
+                    std::memory_order_release);
+    }
+
+    /// @brief Number of elements the ring holds
+    std::size_t Capacity() const { return mCapacity; }
+
+   private:
+    std::size_t mCapacity;
+    std::size_t mMask;
+    std::unique_ptr<T[]> mData;
+
+    // Producer side: its own index and its last view of the consumer's
+    alignas(64) std::atomic<std::size_t> mWrite{0};
+    std::size_t mCachedRead{0};
+
+    // Consumer side: its own index and its last view of the producer's
+    alignas(64) std::atomic<std::size_t> mRead{0};
+    std::size_t mCachedWrite{0};
+};
+
+}  // namespace threading
+}  // namespace solo
+
+#endif  // SOLO_THREADING_SPSC_RING_H
@@ -0,0 +1,75 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_THREADING_THREAD_PLACEMENT_H
+#define SOLO_THREADING_THREAD_PLACEMENT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace threading {
+
+/// @brief Where and how a thread is scheduled. The defaults leave the
+/// thread as the operating system created it.
+struct ThreadPlacement {
+    /// Logical CPUs the thread may run on; empty allows any
+    std::vector<std::size_t> cpus;
+    /// SCHED_FIFO priority from 1 to 99; 0 keeps the time-sharing policy
+    int realtime_priority{0};
+};
+
+/// @brief Pins the calling thread and sets its scheduling policy.
+/// Supported on Linux only; a real-time priority usually needs
+/// CAP_SYS_NICE or an rtprio limit.
+/// @param placement CPUs and priority to apply
+/// @return False if any part of the placement could not be applied
+bool PlaceCurrentThread(const ThreadPlacement& placement);
+
+/// @brief Returns the whole pages inside a buffer to the kernel, so the
+/// next write to each page allocates it on the NUMA node of the writing
+/// thread. Released pages read as zero until written.
+/// @param data Start of the buffer
+/// @param bytes Size of the buffer
+/// @return False where pages cannot be released; the buffer is unchanged
+bool ReleasePages(void* data, std::size_t bytes);
+
+/// @brief Moves the pages of a column next to the threads that update it.
+/// The column is rewritten in the chunks a ParallelFor with the same grain
+/// deals to each participant, so every participant touches the pages of
+/// its own block first. The contents are unchanged.
+/// @param pool Pool the column is updated on, or nullptr for the caller
+/// @param column Column to move
+/// @param grain Chunk size of the updates
+template <typename T>
+void FirstTouch(ThreadPool* pool, std::vector<T>& column, std::size_t grain) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Pages are released and refilled byte for byte");
+
+    const std::vector<T> saved(column);
+    if (!ReleasePages(column.data(), column.size() * sizeof(T))) {
+        return;
+    }
+    ParallelFor(pool, column.size(), grain,
+                [&saved, &column](std::size_t begin, std::size_t end) {
+                    std::copy(saved.begin() + begin, saved.begin() + end,
+                              column.begin() + begin);
+                });
+}
+
+}  // namespace threading
+}  // namespace solo
+
+#endif  // SOLO_THREADING_THREAD_PLACEMENT_H
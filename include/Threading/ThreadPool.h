@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#ifndef SOLO_THREADING_THREAD_POOL_H
+#define SOLO_THREADING_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace solo {
+namespace threading {
+
+struct ThreadPlacement;
+
+/// @brief Persistent pool of worker threads executing parallel-for jobs.
+/// The range of a job is cut into fixed size chunks which are dealt out
+/// evenly to one queue per participant. Each participant drains its own
+/// queue first and then steals chunks from the others, so uneven chunk cost
+/// is balanced without any locking. The calling thread takes part in every
+/// job, so a pool of N threads owns N - 1 workers.
+class ThreadPool {
+   public:
+    /// @brief Constructs the pool and launches its workers
+    /// @param thread_count Total threads taking part in a job, including the
+    /// caller. Zero selects std::thread::hardware_concurrency().
+    explicit ThreadPool(std::size_t thread_count);
+
+    /// @brief Constructs the pool and places each worker before it joins.
+    /// Returns once every worker has applied its placement.
+    /// @param thread_count As above
+    /// @param placements Placement of worker i + 1, the caller being
+    /// participant 0; workers past the end are left unplaced
+    ThreadPool(std::size_t thread_count,
+               const std::vector<ThreadPlacement>& placements);
+
+    /// @brief Stops and joins every worker
+    ~ThreadPool();
+
+    // Prevent copy and assignment
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Prevent move and assignment
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /// @brief Number of threads taking part in a job, including the caller
+    /// @return thread count
+    std::size_t GetThreadCount() const { return mQueueCount; }
+
+    /// @brief Workers whose placement could not be applied
+    /// @return failure count
+    std::size_t GetPlacementFailures() const { return mPlacementFailures; }
+
+    /// @brief Runs function(begin, end) over [0, count) in chunks of at most
+    /// grain elements and returns once every chunk has completed.
+    /// Only one job may be in flight at a time and function must not throw.
+    /// @param count Number of elements in the range
+    /// @param grain Maximum number of elements per chunk
+    /// @param function Callable invoked as function(begin, end)
+    template <typename Function>
+    void ParallelFor(std::size_t count, std::size_t grain,
+                     Function&& function) {
+        using FunctionType = std::remove_reference_t<Function>;
+        const RangeFunction trampoline = [](void* context, std::size_t begin,
+                                            std::size_t end) {
+            (*static_cast<FunctionType*>(context))(begin, end);
+        };
+        Run(count, grain, trampoline,
+            const_cast<void*>(  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                static_cast<const void*>(std::addressof(function))));
+    }
+
+   private:
+    using RangeFunction = void (*)(void* context, std::size_t begin,
+                                   std::size_t end);
+
+    /// @brief Chunk queue owned by one participant, padded to a cache line
+    struct alignas(64) ChunkQueue {
+        std::atomic<std::size_t> next{0};
+        std::size_t end{0};
+    };
+
+    void Run(std::size_t count, std::size_t grain, RangeFunction function,
+             void* context);
+    void WorkerLoop(std::size_t queue_index);
+    void ExecuteChunks(std::size_t queue_index);
+
+    std::size_t mQueueCount{1};
+    std::unique_ptr<ChunkQueue[]> mQueues;
+    std::vector<std::thread> mWorkers;
+
+    // Current job
+    RangeFunction mFunction{nullptr};
+    void* mContext{nullptr};
+    std::size_t mCount{0};
+    std::size_t mGrain{1};
+
+    std::atomic<std::uint64_t> mGeneration{0};
+    std::atomic<std::size_t> mBusyWorkers{0};
+    std::atomic<bool> mStopping{false};
+    std::size_t mPlacementFailures{0};
+};
+
+/// @brief Runs function(begin, end) over [0, count) in chunks of at most
+/// grain elements, on the pool when there is one and otherwise chunk by
+/// chunk on the calling thread. Chunk boundaries are the same either way.
+/// @param pool Pool to run on, or nullptr
+/// @param count Number of elements in the range
+/// @param grain Maximum number of elements per chunk
+/// @param function Callable invoked as function(begin, end)
+template <typename Function>
+void ParallelFor(ThreadPool* pool, std::size_t count, std::size_t grain,
+                 Function&& function) {
+    if (pool != nullptr) {
+        pool->ParallelFor(count, grain, std::forward<Function>(function));
+        return;
+    }
+    for (std::size_t begin = 0; begin < count; begin += grain) {
+        function(begin, std::min(begin + grain, count));
+    }
+}
+
+}  // namespace threading
+}  // namespace solo
+
+#endif  // SOLO_THREADING_THREAD_POOL_H
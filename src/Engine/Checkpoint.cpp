@@ -0,0 +1,507 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/Checkpoint.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Particle/ParticleHandle.h"
+#include "Particle/ParticleStore.h"
+
+namespace solo {
+namespace engine {
+
+namespace {
+
+constexpr std::array<char, 8> kMagic{'S', 'O', 'L', 'O', 'C', 'K', 'P', 'T'};
+constexpr std::uint32_t kByteOrderTag{0x01020304};
+
+// Handles, slot generations, mass, the three components of each of the
+// six vector columns, radius, the previous acceleration, tags, then the
+// store's groups, idle ticks, group starts and pending wakes.
+constexpr std::uint32_t kStoreSectionCount{3 + 7 * 3 + 2 + 4};
+// Rate group divisors, phase members and times, the three joiner columns,
+// then the three expiry columns.
+constexpr std::uint32_t kSectionCount{kStoreSectionCount + 3 + 3 + 3};
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint64_t file_size;
+    std::uint64_t particle_count;
+    std::uint64_t slot_count;
+    std::uint64_t tick_count;
+    double simulation_time;
+    double world_time;
+    double emitter_time;
+    std::uint64_t group_count;
+    std::uint64_t pending_wake_count;
+    std::uint64_t joiner_count;
+    std::uint64_t expiry_count;
+    std::uint32_t rate_group_count;
+    std::uint32_t phase_count;
+    std::uint32_t section_count;
+    std::uint32_t reserved;
+};
+
+struct SectionEntry {
+    std::uint32_t id;
+    std::uint32_t element_size;
+    std::uint64_t offset;
+    std::uint64_t bytes;
+};
+
+static_assert(std::is_trivially_copyable_v<FileHeader>);
+static_assert(std::is_trivially_copyable_v<SectionEntry>);
+static_assert(std::is_trivially_copyable_v<physics::ParticleHandle>);
+static_assert(sizeof(FileHeader) + kSectionCount * sizeof(SectionEntry) <=
+              Checkpoint::ALIGNMENT);
+
+/// @brief Raw bytes of one column, in section order.
+struct ColumnBytes {
+    const void* data;
+    std::uint32_t element_size;
+    std::uint64_t count;
+};
+
+template <typename T>
+ColumnBytes Bytes(const std::vector<T>& column) {
+    return {column.data(), sizeof(T), column.size()};
+}
+
+template <typename T>
+void AppendColumns(std::vector<ColumnBytes>& columns,
+                   const physics::VectorColumns<T>& vector) {
+    columns.push_back(Bytes(vector.x));
+    columns.push_back(Bytes(vector.y));
+    columns.push_back(Bytes(vector.z));
+}
+
+template <typename T>
+void AppendColumns(std::vector<std::vector<T>*>& columns,
+                   physics::VectorColumns<T>& vector) {
+    columns.push_back(&vector.x);
+    columns.push_back(&vector.y);
+    columns.push_back(&vector.z);
+}
+
+std::uint64_t AlignUp(std::uint64_t value) {
+    return (value + Checkpoint::ALIGNMENT - 1) / Checkpoint::ALIGNMENT *
+           Checkpoint::ALIGNMENT;
+}
+
+[[noreturn]] void Fail(const std::filesystem::path& path,
+                       const std::string& reason) {
+    throw std::runtime_error("Checkpoint " + path.string() + ": " + reason);
+}
+
+/// @brief Read-only memory mapping of a whole file.
+class MappedFile {
+   public:
+    explicit MappedFile(const std::filesystem::path& path);
+    ~MappedFile();
+
+    // Prevent copy and assignment
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Prevent move and assignment
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    const unsigned char* data() const { return mData; }
+    std::uint64_t size() const { return mSize; }
+
+   private:
+    const unsigned char* mData{nullptr};
+    std::uint64_t mSize{0};
+#ifdef _WIN32
+    HANDLE mFile{INVALID_HANDLE_VALUE};
+    HANDLE mMapping{nullptr};
+#endif
+};
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+    mFile = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (mFile == INVALID_HANDLE_VALUE) {
+        Fail(path, "cannot open file");
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(mFile, &size) ||
+        static_cast<std::uint64_t>(size.QuadPart) < sizeof(FileHeader)) {
+        CloseHandle(mFile);
+        Fail(path, "file is too small");
+    }
+    mSize = static_cast<std::uint64_t>(size.QuadPart);
+
+    mMapping = CreateFileMappingW(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mMapping == nullptr
+                           ? nullptr
+                           : MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        if (mMapping != nullptr) {
+            CloseHandle(mMapping);
+        }
+        CloseHandle(mFile);
+        Fail(path, "cannot map file");
+    }
+    mData = static_cast<const unsigned char*>(view);
+}
+
+MappedFile::~MappedFile() {
+    UnmapViewOfFile(mData);
+    CloseHandle(mMapping);
+    CloseHandle(mFile);
+}
+
+#else
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+    const int file = open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        Fail(path, "cannot open file");
+    }
+
+    struct stat status{};
+    if (fstat(file, &status) != 0 ||
+        static_cast<std::uint64_t>(status.st_size) < sizeof(FileHeader)) {
+        close(file);
+        Fail(path, "file is too small");
+    }
+    mSize = static_cast<std::uint64_t>(status.st_size);
+
+    void* view = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, file, 0);
+    // The mapping keeps its own reference to the file.
+    close(file);
+    if (view == MAP_FAILED) {
+        Fail(path, "cannot map file");
+    }
+
+    // Every section is read front to back exactly once.
+    madvise(view, mSize, MADV_SEQUENTIAL);
+    mData = static_cast<const unsigned char*>(view);
+}
+
+MappedFile::~MappedFile() {
+    munmap(const_cast<unsigned char*>(mData), mSize);
+}
+
+#endif
+
+}  // namespace
+
+void Checkpoint::Save(const std::filesystem::path& path,
+                      const physics::ParticleStore& store,
+                      const CheckpointClock& clock,
+                      const CheckpointSchedule& schedule) {
+    const std::uint32_t slot_count = store.GetSlotCount();
+    std::vector<std::uint32_t> generations(slot_count);
+    for (std::uint32_t slot = 0; slot < slot_count; ++slot) {
+        generations[slot] = store.GetSlotGeneration(slot);
+    }
+
+    const auto group_count =
+        static_cast<std::uint32_t>(store.GetGroupCount());
+    std::vector<std::uint64_t> group_starts;
+    group_starts.reserve(group_count + 1);
+    for (std::uint32_t group = 0; group < group_count; ++group) {
+        group_starts.push_back(store.GetGroupRange(group).first);
+    }
+    group_starts.push_back(store.GetAwakeCount());
+
+    const std::size_t expiry_count = schedule.expiries.size();
+    std::vector<double> expiry_times(expiry_count);
+    std::vector<physics::ParticleHandle> expiry_handles(expiry_count);
+    std::vector<std::uint32_t> expiry_emitters(expiry_count);
+    for (std::size_t i = 0; i < expiry_count; ++i) {
+        expiry_times[i] = schedule.expiries[i].time;
+        expiry_handles[i] = schedule.expiries[i].handle;
+        expiry_emitters[i] = schedule.expiries[i].emitter;
+    }
+
+    std::vector<ColumnBytes> columns;
+    columns.reserve(kSectionCount);
+    columns.push_back(Bytes(store.Handles()));
+    columns.push_back(Bytes(generations));
+    columns.push_back(Bytes(store.Mass()));
+    AppendColumns(columns, store.Position());
+    AppendColumns(columns, store.Velocity());
+    AppendColumns(columns, store.Acceleration());
+    AppendColumns(columns, store.Angle());
+    AppendColumns(columns, store.AngularVelocity());
+    AppendColumns(columns, store.AngularAcceleration());
+    columns.push_back(Bytes(store.Radius()));
+    AppendColumns(columns, store.PreviousAcceleration());
+    columns.push_back(Bytes(store.Tags()));
+    columns.push_back(Bytes(store.Groups()));
+    columns.push_back(Bytes(store.IdleTicks()));
+    columns.push_back(Bytes(group_starts));
+    columns.push_back(Bytes(store.PendingWakes()));
+    columns.push_back(Bytes(schedule.divisors));
+    columns.push_back(Bytes(schedule.phase_members));
+    columns.push_back(Bytes(schedule.group_times));
+    columns.push_back(Bytes(schedule.joiner_groups));
+    columns.push_back(Bytes(schedule.joiner_handles));
+    columns.push_back(Bytes(schedule.joiner_times));
+    columns.push_back(Bytes(expiry_times));
+    columns.push_back(Bytes(expiry_handles));
+    columns.push_back(Bytes(expiry_emitters));
+
+    // Lay the sections out on aligned offsets after the header page.
+    std::vector<SectionEntry> sections(kSectionCount);
+    std::uint64_t offset = ALIGNMENT;
+    for (std::uint32_t i = 0; i < kSectionCount; ++i) {
+        sections[i].id = i;
+        sections[i].element_size = columns[i].element_size;
+        sections[i].offset = offset;
+        sections[i].bytes = columns[i].count * columns[i].element_size;
+        offset = AlignUp(offset + sections[i].bytes);
+    }
+
+    FileHeader header{};
+    header.magic = kMagic;
+    header.version = VERSION;
+    header.byte_order = kByteOrderTag;
+    header.file_size = offset;
+    header.particle_count = store.size();
+    header.slot_count = slot_count;
+    header.tick_count = clock.tick_count;
+    header.simulation_time = clock.simulation_time;
+    header.world_time = schedule.world_time;
+    header.emitter_time = schedule.emitter_time;
+    header.group_count = group_count;
+    header.pending_wake_count = store.PendingWakes().size();
+    header.joiner_count = schedule.joiner_groups.size();
+    header.expiry_count = expiry_count;
+    header.rate_group_count =
+        static_cast<std::uint32_t>(schedule.divisors.size());
+    header.phase_count =
+        static_cast<std::uint32_t>(schedule.phase_members.size());
+    header.section_count = kSectionCount;
+
+    std::vector<char> first_page(ALIGNMENT, 0);
+    std::memcpy(first_page.data(), &header, sizeof(header));
+    std::memcpy(first_page.data() + sizeof(header), sections.data(),
+                sections.size() * sizeof(SectionEntry));
+
+    // Write beside the target and rename, so a crash mid-save never
+    // leaves a truncated checkpoint under the real name.
+    std::filesystem::path temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            Fail(temporary, "cannot create file");
+        }
+
+        const std::vector<char> padding(ALIGNMENT, 0);
+        file.write(first_page.data(),
+                   static_cast<std::streamsize>(first_page.size()));
+        for (std::uint32_t i = 0; i < kSectionCount; ++i) {
+            file.write(static_cast<const char*>(columns[i].data),
+                       static_cast<std::streamsize>(sections[i].bytes));
+            const std::uint64_t end = sections[i].offset + sections[i].bytes;
+            file.write(padding.data(),
+                       static_cast<std::streamsize>(AlignUp(end) - end));
+        }
+
+        file.flush();
+        if (!file) {
+            Fail(temporary, "write failed");
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if (error) {
+        Fail(path, "cannot replace file: " + error.message());
+    }
+}
+
+CheckpointClock Checkpoint::Load(const std::filesystem::path& path,
+                                 physics::ParticleStore& store,
+                                 CheckpointSchedule& schedule) {
+    const MappedFile file(path);
+
+    FileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (header.magic != kMagic) {
+        Fail(path, "not a checkpoint file");
+    }
+    if (header.byte_order != kByteOrderTag) {
+        Fail(path, "written with a different byte order");
+    }
+    if (header.version != VERSION) {
+        Fail(path, "unsupported version " + std::to_string(header.version));
+    }
+    if (header.file_size != file.size()) {
+        Fail(path, "file is truncated");
+    }
+    if (header.section_count != kSectionCount) {
+        Fail(path, "unexpected section count");
+    }
+    if (header.particle_count > header.slot_count ||
+        header.slot_count > physics::ParticleHandle::INVALID_INDEX) {
+        Fail(path, "invalid particle or slot count");
+    }
+
+    std::vector<SectionEntry> sections(kSectionCount);
+    std::memcpy(sections.data(), file.data() + sizeof(header),
+                sections.size() * sizeof(SectionEntry));
+
+    physics::ParticleStore restored;
+    std::vector<physics::ParticleHandle> handles;
+    std::vector<std::uint32_t> generations;
+
+    std::vector<std::vector<double>*> double_columns{&restored.Mass()};
+    AppendColumns(double_columns, restored.Position());
+    std::vector<std::vector<float>*> float_columns;
+    AppendColumns(float_columns, restored.Velocity());
+    AppendColumns(float_columns, restored.Acceleration());
+    AppendColumns(float_columns, restored.Angle());
+    AppendColumns(float_columns, restored.AngularVelocity());
+    AppendColumns(float_columns, restored.AngularAcceleration());
+    float_columns.push_back(&restored.Radius());
+    AppendColumns(float_columns, restored.PreviousAcceleration());
+
+    // Check a section against the header and copy it into its column.
+    const auto read = [&](std::uint32_t id, auto& column,
+                          std::uint64_t count) {
+        using T = typename std::remove_reference_t<decltype(column)>::value_type;
+        const SectionEntry& section = sections[id];
+        if (section.id != id || section.element_size != sizeof(T) ||
+            section.bytes != count * sizeof(T) ||
+            section.offset % ALIGNMENT != 0 ||
+            section.offset > file.size() ||
+            section.bytes > file.size() - section.offset) {
+            Fail(path, "section " + std::to_string(id) + " is malformed");
+        }
+        column.resize(static_cast<std::size_t>(count));
+        std::memcpy(column.data(), file.data() + section.offset,
+                    static_cast<std::size_t>(section.bytes));
+    };
+
+    std::uint32_t id = 0;
+    read(id++, handles, header.particle_count);
+    read(id++, generations, header.slot_count);
+    for (std::vector<double>* column : double_columns) {
+        read(id++, *column, header.particle_count);
+    }
+    for (std::vector<float>* column : float_columns) {
+        read(id++, *column, header.particle_count);
+    }
+    read(id++, restored.Tags(), header.particle_count);
+
+    std::vector<std::uint32_t> groups;
+    std::vector<std::uint32_t> idle_ticks;
+    std::vector<std::uint64_t> group_starts;
+    std::vector<physics::ParticleHandle> pending_wakes;
+    read(id++, groups, header.particle_count);
+    read(id++, idle_ticks, header.particle_count);
+    read(id++, group_starts, header.group_count + 1);
+    read(id++, pending_wakes, header.pending_wake_count);
+
+    CheckpointSchedule saved;
+    std::vector<double> expiry_times;
+    std::vector<physics::ParticleHandle> expiry_handles;
+    std::vector<std::uint32_t> expiry_emitters;
+    read(id++, saved.divisors, header.rate_group_count);
+    read(id++, saved.phase_members, header.phase_count);
+    read(id++, saved.group_times, header.phase_count);
+    read(id++, saved.joiner_groups, header.joiner_count);
+    read(id++, saved.joiner_handles, header.joiner_count);
+    read(id++, saved.joiner_times, header.joiner_count);
+    read(id++, expiry_times, header.expiry_count);
+    read(id++, expiry_handles, header.expiry_count);
+    read(id++, expiry_emitters, header.expiry_count);
+
+    // Rate groups are settings of the world, so the phases only line up
+    // with a world configured the same way.
+    if (saved.divisors != schedule.divisors) {
+        Fail(path, "saved with different rate groups");
+    }
+    std::uint64_t phase_count = 0;
+    for (const std::uint32_t divisor : saved.divisors) {
+        phase_count += divisor;
+    }
+    if (phase_count != header.phase_count ||
+        std::any_of(saved.joiner_groups.begin(), saved.joiner_groups.end(),
+                    [phase_count](std::uint32_t group) {
+                        return group >= phase_count;
+                    })) {
+        Fail(path, "rate group phases are malformed");
+    }
+
+    saved.world_time = header.world_time;
+    saved.emitter_time = header.emitter_time;
+    saved.expiries.resize(static_cast<std::size_t>(header.expiry_count));
+    for (std::size_t i = 0; i < saved.expiries.size(); ++i) {
+        saved.expiries[i].time = expiry_times[i];
+        saved.expiries[i].handle = expiry_handles[i];
+        saved.expiries[i].emitter = expiry_emitters[i];
+    }
+
+    try {
+        restored.RestoreSlots(std::move(handles), generations);
+        restored.RestoreGroups(
+            std::move(groups), std::move(idle_ticks),
+            std::vector<std::size_t>(group_starts.begin(), group_starts.end()),
+            std::move(pending_wakes));
+    } catch (const std::invalid_argument& error) {
+        Fail(path, error.what());
+    }
+    // Local frames and closed-form motion are settings of the store rather
+    // than saved state.
+    if (store.HasLocalFrames()) {
+        restored.EnableLocalFrames(store.GetRegionSize());
+    }
+    if (store.HasClosedFormMotion()) {
+        restored.EnableClosedFormMotion();
+    }
+
+    store = std::move(restored);
+    schedule = std::move(saved);
+    return {header.tick_count, header.simulation_time};
+}
+
+}  // namespace engine
+}  // namespace solo
@@ -9,26 +9,100 @@
 // See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
 // -----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <atomic>
+#include <barrier>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <stdexcept>
+#include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
+#include "Engine/Checkpoint.h"
+#include "Engine/Command.h"
 #include "Engine/Engine.h"
+#include "Engine/FixedStepScheduler.h"
+#include "Engine/LatencyHistogram.h"
+#include "Engine/SnapshotBuffer.h"
+#include "Engine/TickArena.h"
+#include "Engine/TickObserver.h"
+#include "Engine/World.h"
+#include "Math/Vector.h"
 #include "Particle/Particle.h"
+#include "Particle/ParticleHandle.h"
+#include "Particle/ParticleStore.h"
+#include "Physics/BarnesHut.h"
+#include "Physics/BroadPhase.h"
+#include "Physics/EmitterRegistry.h"
+#include "Physics/ForceRegistry.h"
+#include "Physics/Integrators.h"
+#include "Physics/SpatialGrid.h"
+#include "Threading/ThreadPlacement.h"
+#include "Threading/ThreadPool.h"
 
 namespace solo {
 namespace engine {
 
-Engine::~Engine() { Stop(); }
+namespace {
 
-void Engine::Start(double tick_rate_hz) {
+// Particles copied into a snapshot per pool chunk.
+constexpr std::size_t kParticleChunkSize = 8192;
+
+using Clock = std::chrono::steady_clock;
+
+/// @brief Nanoseconds between two clock readings.
+std::uint64_t ElapsedNanoseconds(Clock::time_point begin,
+                                 Clock::time_point end) {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin)
+            .count());
+}
+
+}  // namespace
+
+Engine::Engine(physics::IntegratorType integrator,
+               std::pmr::memory_resource* upstream)
+    : mPool(upstream), mTickArena(TickArena::DEFAULT_CAPACITY, &mPool) {
+    mWorlds.push_back(std::make_unique<World>(integrator, &mPool));
+}
+
+Engine::~Engine() {
+    try {
+        Stop();
+    } catch (...) {
+        // A loop failure can only be reported by an explicit Stop().
+    }
+}
+
+void Engine::Start(double tick_rate_hz, std::size_t thread_count) {
+    StartOptions options;
+    options.thread_count = thread_count;
+    Start(tick_rate_hz, options);
+}
+
+void Engine::Start(double tick_rate_hz, const StartOptions& options) {
     if (mRunning) {
         return;
     }
+    if (mLoopThread.joinable()) {
+        throw std::logic_error(
+            "The simulation loop stopped on an exception; call Stop() first");
+    }
 
+    LeaveIdle();
+    StartWorkers(options);
     mRunning = true;
-    mLoopThread = std::thread(&Engine::SimulationLoop, this, tick_rate_hz);
+    mLoopThread = std::thread(&Engine::SimulationLoop, this, tick_rate_hz,
+                              options.loop_thread, options.first_touch);
 }
 
 void Engine::Stop() {
@@ -36,43 +110,904 @@ void Engine::Stop() {
     if (mLoopThread.joinable()) {
         mLoopThread.join();
     }
+    SyncPositions();
+    StopWorkers();
+
+    // Anything queued while the loop was shutting down.
+    EnterIdle();
+
+    if (mLoopFailure) {
+        std::exception_ptr failure;
+        std::swap(failure, mLoopFailure);
+        std::rethrow_exception(failure);
+    }
 }
 
 bool Engine::IsRunning() const { return mRunning; }
 
-void Engine::AddParticle(const physics::Particle& particle) {
-    mParticles.push_back(particle);
+SchedulerStats Engine::GetSchedulerStats() const {
+    return mScheduler.GetStats();
+}
+
+EngineStats Engine::GetStats() const {
+    EngineStats stats;
+    stats.tick = mTickTimes.Summarize();
+    stats.commands = mCommandTimes.Summarize();
+    stats.forces = mForceTimes.Summarize();
+    stats.integrate = mIntegrateTimes.Summarize();
+    stats.broad_phase = mBroadPhaseTimes.Summarize();
+    stats.spatial_index = mSpatialIndexTimes.Summarize();
+    stats.snapshot = mSnapshotTimes.Summarize();
+    stats.observers = mObserverTimes.Summarize();
+    stats.overruns = mOverruns.load(std::memory_order_relaxed);
+    stats.placement_failures =
+        mPlacementFailures.load(std::memory_order_relaxed);
+    stats.observer_overruns =
+        mObserverOverruns.load(std::memory_order_relaxed);
+    stats.scheduler = mScheduler.GetStats();
+    return stats;
+}
+
+physics::ParticleHandle Engine::AddParticle(
+    const physics::Particle& particle) {
+    return AddParticle(DEFAULT_WORLD, particle);
+}
+
+void Engine::RemoveParticle(physics::ParticleHandle handle) {
+    RemoveParticle(DEFAULT_WORLD, handle);
+}
+
+void Engine::SetParticleVelocity(physics::ParticleHandle handle,
+                                 const math::Vector& velocity) {
+    SetParticleVelocity(DEFAULT_WORLD, handle, velocity);
+}
+
+void Engine::SetParticleAcceleration(physics::ParticleHandle handle,
+                                     const math::Vector& acceleration) {
+    SetParticleAcceleration(DEFAULT_WORLD, handle, acceleration);
+}
+
+RateGroupId Engine::AddRateGroup(std::uint32_t divisor) {
+    return AddRateGroup(DEFAULT_WORLD, divisor);
+}
+
+RateGroupId Engine::AddRateGroup(WorldId world, std::uint32_t divisor) {
+    if (mRunning) {
+        throw std::logic_error("Cannot add a rate group while running");
+    }
+    return GetWorld(world).AddRateGroup(divisor);
+}
+
+void Engine::SetParticleRateGroup(physics::ParticleHandle handle,
+                                  RateGroupId group) {
+    SetParticleRateGroup(DEFAULT_WORLD, handle, group);
+}
+
+WorldId Engine::AddWorld(physics::IntegratorType integrator) {
+    if (mRunning) {
+        throw std::logic_error("Cannot add a world while running");
+    }
+
+    mWorlds.push_back(std::make_unique<World>(integrator, &mPool));
+    return static_cast<WorldId>(mWorlds.size() - 1);
+}
+
+std::size_t Engine::GetWorldCount() const { return mWorlds.size(); }
+
+World& Engine::GetWorld(WorldId world) {
+    CheckWorld(world);
+    return *mWorlds[world];
+}
+
+const World& Engine::GetWorld(WorldId world) const {
+    CheckWorld(world);
+    return *mWorlds[world];
+}
+
+physics::ParticleHandle Engine::AddParticle(
+    WorldId world, const physics::Particle& particle) {
+    Command command;
+    command.type = CommandType::AddParticle;
+    command.world = world;
+    command.handle = GetWorld(world).GetParticles().ReserveHandle();
+    command.particle = particle;
+    Submit(command);
+    return command.handle;
+}
+
+void Engine::RemoveParticle(WorldId world, physics::ParticleHandle handle) {
+    CheckWorld(world);
+
+    Command command;
+    command.type = CommandType::RemoveParticle;
+    command.world = world;
+    command.handle = handle;
+    Submit(command);
+}
+
+void Engine::SetParticleVelocity(WorldId world,
+                                 physics::ParticleHandle handle,
+                                 const math::Vector& velocity) {
+    CheckWorld(world);
+
+    Command command;
+    command.type = CommandType::SetVelocity;
+    command.world = world;
+    command.handle = handle;
+    command.vector = velocity;
+    Submit(command);
+}
+
+void Engine::SetParticleAcceleration(WorldId world,
+                                     physics::ParticleHandle handle,
+                                     const math::Vector& acceleration) {
+    CheckWorld(world);
+
+    Command command;
+    command.type = CommandType::SetAcceleration;
+    command.world = world;
+    command.handle = handle;
+    command.vector = acceleration;
+    Submit(command);
+}
+
+void Engine::SetParticleRateGroup(WorldId world,
+                                  physics::ParticleHandle handle,
+                                  RateGroupId group) {
+    if (group >= GetWorld(world).GetRateGroupCount()) {
+        throw std::out_of_range("Rate group: " + std::to_string(group) +
+                                " does not exist");
+    }
+
+    Command command;
+    command.type = CommandType::SetRateGroup;
+    command.world = world;
+    command.handle = handle;
+    command.value = group;
+    Submit(command);
+}
+
+physics::ParticleHandle Engine::MigrateParticle(
+    WorldId from, physics::ParticleHandle handle, WorldId to) {
+    CheckWorld(from);
+
+    Command command;
+    command.type = CommandType::MigrateParticle;
+    command.world = from;
+    command.handle = handle;
+    command.target = GetWorld(to).GetParticles().ReserveHandle();
+    command.value = to;
+    Submit(command);
+    return command.target;
 }
 
 void Engine::UpdateParticles(double time_step) {
-    const std::size_t particle_count = mParticles.size();
-    for (std::size_t i = 0; i < particle_count; ++i) {
-        mParticles[i].Update(time_step);
+    const Clock::time_point tick_start = Clock::now();
+
+    mTickArena.Reset();
+    ApplyCommands();
+    const Clock::time_point commands_done = Clock::now();
+
+    StepWorlds(time_step);
+    const Clock::time_point index_done = Clock::now();
+
+    mTickCount.fetch_add(1, std::memory_order_relaxed);
+    mSimulationTime.store(
+        mSimulationTime.load(std::memory_order_relaxed) + time_step,
+        std::memory_order_relaxed);
+
+    // An engine without observers pays for this check and nothing else.
+    Clock::time_point observers_done = index_done;
+    if (!mLoopObservers.empty() || !mWorkerObservers.empty()) {
+        NotifyObservers();
+        observers_done = Clock::now();
+        mObserverTimes.Record(ElapsedNanoseconds(index_done, observers_done));
+    }
+
+    PublishSnapshot();
+    if (!mRunning) {
+        // Called directly, so the caller may read the store next.
+        SyncPositions();
+    }
+    const Clock::time_point tick_done = Clock::now();
+
+    const std::uint64_t tick_time = ElapsedNanoseconds(tick_start, tick_done);
+    mTickTimes.Record(tick_time);
+    mCommandTimes.Record(ElapsedNanoseconds(tick_start, commands_done));
+    mSnapshotTimes.Record(ElapsedNanoseconds(observers_done, tick_done));
+    if (static_cast<double>(tick_time) > time_step * 1e9) {
+        mOverruns.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void Engine::EnableSleeping(const SleepSettings& settings) {
+    EnableSleeping(DEFAULT_WORLD, settings);
+}
+
+void Engine::EnableSleeping(WorldId world, const SleepSettings& settings) {
+    if (mRunning) {
+        throw std::logic_error("Cannot enable sleeping while running");
+    }
+    GetWorld(world).EnableSleeping(settings);
+}
+
+std::size_t Engine::GetAwakeParticleCount() const {
+    return DefaultWorld().GetAwakeParticleCount();
+}
+
+std::size_t Engine::GetParticleCount() const {
+    return DefaultWorld().GetParticleCount();
+}
+
+std::uint64_t Engine::GetTickCount() const {
+    return mTickCount.load(std::memory_order_relaxed);
+}
+
+double Engine::GetSimulationTime() const {
+    return mSimulationTime.load(std::memory_order_relaxed);
+}
+
+void Engine::SetIntegrator(physics::IntegratorType integrator) {
+    SetIntegrator(DEFAULT_WORLD, integrator);
+}
+
+void Engine::SetIntegrator(WorldId world, physics::IntegratorType integrator) {
+    if (mRunning) {
+        throw std::logic_error("Cannot change the integrator while running");
+    }
+
+    GetWorld(world).SetIntegrator(integrator);
+}
+
+physics::IntegratorType Engine::GetIntegrator() const {
+    return DefaultWorld().GetIntegrator();
+}
+
+void Engine::EnableLocalFrames(double region_size) {
+    EnableLocalFrames(DEFAULT_WORLD, region_size);
+}
+
+void Engine::EnableLocalFrames(WorldId world, double region_size) {
+    if (mRunning) {
+        throw std::logic_error("Cannot enable local frames while running");
+    }
+
+    GetWorld(world).EnableLocalFrames(region_size);
+}
+
+void Engine::EnableClosedFormMotion() {
+    EnableClosedFormMotion(DEFAULT_WORLD);
+}
+
+void Engine::EnableClosedFormMotion(WorldId world) {
+    if (mRunning) {
+        throw std::logic_error(
+            "Cannot enable closed-form motion while running");
+    }
+
+    GetWorld(world).EnableClosedFormMotion();
+}
+
+void Engine::EnableSnapshots(std::size_t slot_count) {
+    if (mRunning) {
+        throw std::logic_error("Cannot enable snapshots while running");
+    }
+    mSnapshots = std::make_unique<SnapshotBuffer>(slot_count);
+}
+
+PinnedSnapshot Engine::AcquireSnapshot() const {
+    if (!mSnapshots) {
+        return {};
+    }
+    return mSnapshots->Acquire();
+}
+
+void Engine::EnableGravity(const physics::BarnesHutSettings& settings) {
+    EnableGravity(DEFAULT_WORLD, settings);
+}
+
+void Engine::EnableGravity(WorldId world,
+                           const physics::BarnesHutSettings& settings) {
+    if (mRunning) {
+        throw std::logic_error("Cannot enable gravity while running");
+    }
+    GetWorld(world).EnableGravity(settings);
+}
+
+physics::ForceGeneratorId Engine::AddForceGenerator(
+    const physics::ForceGenerator& generator) {
+    return AddForceGenerator(DEFAULT_WORLD, generator);
+}
+
+physics::ForceGeneratorId Engine::AddForceGenerator(
+    WorldId world, const physics::ForceGenerator& generator) {
+    if (mRunning) {
+        throw std::logic_error("Cannot add a force generator while running");
     }
+    return GetWorld(world).AddForceGenerator(generator);
 }
 
-std::size_t Engine::GetParticleCount() const { return mParticles.size(); }
+bool Engine::RemoveForceGenerator(physics::ForceGeneratorId id) {
+    return RemoveForceGenerator(DEFAULT_WORLD, id);
+}
+
+bool Engine::RemoveForceGenerator(WorldId world, physics::ForceGeneratorId id) {
+    if (mRunning) {
+        throw std::logic_error("Cannot remove a force generator while running");
+    }
+    return GetWorld(world).RemoveForceGenerator(id);
+}
 
-std::vector<physics::Particle>& Engine::GetParticles() { return mParticles; }
+physics::EmitterId Engine::AddEmitter(const physics::Emitter& emitter) {
+    return AddEmitter(DEFAULT_WORLD, emitter);
+}
 
-void Engine::SimulationLoop(double tick_rate_hz) {
-    const auto interval =
-        std::chrono::duration<double>(1.0 / tick_rate_hz);
-    const double time_step = 1.0 / tick_rate_hz;
+physics::EmitterId Engine::AddEmitter(WorldId world,
+                                      const physics::Emitter& emitter) {
+    if (mRunning) {
+        throw std::logic_error("Cannot add an emitter while running");
+    }
+    return GetWorld(world).AddEmitter(emitter);
+}
 
-    while (mRunning) {
-        const auto start_time = std::chrono::steady_clock::now();
+bool Engine::RemoveEmitter(physics::EmitterId id) {
+    return RemoveEmitter(DEFAULT_WORLD, id);
+}
+
+bool Engine::RemoveEmitter(WorldId world, physics::EmitterId id) {
+    if (mRunning) {
+        throw std::logic_error("Cannot remove an emitter while running");
+    }
+    return GetWorld(world).RemoveEmitter(id);
+}
+
+void Engine::EmitBurst(physics::EmitterId id, std::uint32_t count) {
+    EmitBurst(DEFAULT_WORLD, id, count);
+}
+
+void Engine::EmitBurst(WorldId world, physics::EmitterId id,
+                       std::uint32_t count) {
+    CheckWorld(world);
+
+    Command command;
+    command.type = CommandType::EmitBurst;
+    command.world = world;
+    command.value = id;
+    command.count = count;
+    Submit(command);
+}
+
+void Engine::EnableBroadPhase(CollisionCallback callback) {
+    EnableBroadPhase(DEFAULT_WORLD, std::move(callback));
+}
+
+void Engine::EnableBroadPhase(WorldId world, CollisionCallback callback) {
+    if (mRunning) {
+        throw std::logic_error("Cannot enable the broad phase while running");
+    }
+    GetWorld(world).EnableBroadPhase(std::move(callback));
+}
+
+const std::vector<physics::CollisionPair>& Engine::GetCollisionPairs() const {
+    return DefaultWorld().GetCollisionPairs();
+}
+
+void Engine::EnableSpatialIndex(double cell_size) {
+    EnableSpatialIndex(DEFAULT_WORLD, cell_size);
+}
+
+void Engine::EnableSpatialIndex(WorldId world, double cell_size) {
+    if (mRunning) {
+        throw std::logic_error("Cannot enable the spatial index while running");
+    }
+    GetWorld(world).EnableSpatialIndex(cell_size);
+}
+
+void Engine::EnableMortonOrder(std::uint32_t cadence) {
+    EnableMortonOrder(DEFAULT_WORLD, cadence);
+}
+
+void Engine::EnableMortonOrder(WorldId world, std::uint32_t cadence) {
+    if (mRunning) {
+        throw std::logic_error("Cannot enable Morton order while running");
+    }
+    GetWorld(world).EnableMortonOrder(cadence);
+}
+
+const physics::SpatialGrid* Engine::GetSpatialIndex() const {
+    return DefaultWorld().GetSpatialIndex();
+}
+
+ObserverId Engine::AddObserver(const TickObserver& observer) {
+    if (mRunning) {
+        throw std::logic_error("Cannot add an observer while running");
+    }
+    if (observer.function == nullptr) {
+        throw std::invalid_argument("Observer has no function");
+    }
+    CheckWorld(observer.world);
+
+    auto entry = std::make_unique<ObserverEntry>();
+    entry->observer = observer;
+    entry->id = mNextObserverId++;
+    const ObserverId id = entry->id;
+    if (observer.thread == ObserverThread::Worker) {
+        mWorkerObservers.push_back(std::move(entry));
+    } else {
+        mLoopObservers.push_back(std::move(entry));
+    }
+    return id;
+}
+
+bool Engine::RemoveObserver(ObserverId id) {
+    if (mRunning) {
+        throw std::logic_error("Cannot remove an observer while running");
+    }
+
+    for (auto* observers : {&mLoopObservers, &mWorkerObservers}) {
+        const auto found = std::find_if(
+            observers->begin(), observers->end(),
+            [id](const auto& entry) { return entry->id == id; });
+        if (found != observers->end()) {
+            observers->erase(found);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::uint64_t Engine::GetObserverOverruns(ObserverId id) const {
+    const ObserverEntry* entry = FindObserver(id);
+    if (entry == nullptr) {
+        throw std::out_of_range("Observer: " + std::to_string(id) +
+                                " does not exist");
+    }
+    return entry->overruns.load(std::memory_order_relaxed);
+}
+
+void Engine::SaveCheckpoint(const std::filesystem::path& path) const {
+    if (mRunning) {
+        throw std::logic_error("Cannot save a checkpoint while running");
+    }
+    if (mWorlds.size() > 1) {
+        throw std::logic_error(
+            "Checkpoints hold the default world only; the engine has " +
+            std::to_string(mWorlds.size()) + " worlds");
+    }
+
+    CheckpointClock clock;
+    clock.tick_count = GetTickCount();
+    clock.simulation_time = GetSimulationTime();
+    Checkpoint::Save(path, DefaultWorld().GetParticles(), clock,
+                     DefaultWorld().GetSchedule());
+}
+
+void Engine::LoadCheckpoint(const std::filesystem::path& path) {
+    if (mRunning) {
+        throw std::logic_error("Cannot load a checkpoint while running");
+    }
+    if (mWorlds.size() > 1) {
+        throw std::logic_error(
+            "Checkpoints hold the default world only; the engine has " +
+            std::to_string(mWorlds.size()) + " worlds");
+    }
+
+    // Loading checks the saved rate groups against this world's.
+    CheckpointSchedule schedule = DefaultWorld().GetSchedule();
+    const CheckpointClock clock =
+        Checkpoint::Load(path, DefaultWorld().GetParticles(), schedule);
+    DefaultWorld().RestoreSchedule(schedule);
+    mTickCount.store(clock.tick_count, std::memory_order_relaxed);
+    mSimulationTime.store(clock.simulation_time, std::memory_order_relaxed);
+}
+
+physics::ParticleStore& Engine::GetParticles() {
+    return DefaultWorld().GetParticles();
+}
+
+const physics::ParticleStore& Engine::GetParticles() const {
+    return DefaultWorld().GetParticles();
+}
+
+std::uint64_t Engine::RunFor(double duration, double time_step,
+                             const RunOptions& options) {
+    if (mRunning || mLoopThread.joinable()) {
+        throw std::logic_error("Cannot run a batch while running");
+    }
+    if (!(time_step > 0.0) || !(duration >= 0.0) ||
+        !(options.time_scale >= 0.0)) {
+        throw std::invalid_argument(
+            "Batch runs need a positive time step, a duration and a time "
+            "scale of at least zero");
+    }
+
+    // Round so that a duration that is a whole number of steps is not cut
+    // short by floating point error.
+    const auto tick_count =
+        static_cast<std::uint64_t>(std::llround(duration / time_step));
+    const double wall_step =
+        options.time_scale > 0.0 ? time_step / options.time_scale : 0.0;
+
+    // Commands from other threads are queued exactly as with Start().
+    LeaveIdle();
+
+    // However the batch ends, including by an exception from on_tick, an
+    // observer or a stage, the engine is left stopped and idle.
+    struct BatchEnd {
+        Engine& engine;
+        ~BatchEnd() {
+            engine.mRunning = false;
+            engine.SyncPositions();
+            engine.StopWorkers();
+            engine.EnterIdle();
+        }
+    };
+    const BatchEnd batch_end{*this};
+
+    StartWorkers(options.threads);
+    mRunning = true;
+    PrepareLoopThread(options.threads.loop_thread,
+                      options.threads.first_touch);
+
+    const Clock::time_point start = Clock::now();
+    std::uint64_t ticks_run = 0;
+    while (ticks_run < tick_count) {
+        if (wall_step > 0.0) {
+            // Pace against the start so sleep overshoot does not add up.
+            std::this_thread::sleep_until(
+                start + std::chrono::duration_cast<Clock::duration>(
+                            std::chrono::duration<double>(
+                                wall_step * static_cast<double>(ticks_run))));
+        }
 
         UpdateParticles(time_step);
+        ++ticks_run;
+        if (options.on_tick && !options.on_tick(GetTickCount(),
+                                                GetSimulationTime())) {
+            break;
+        }
+    }
+    return ticks_run;
+}
+
+void Engine::SimulationLoop(double tick_rate_hz,
+                            const threading::ThreadPlacement& placement,
+                            bool first_touch) {
+    PrepareLoopThread(placement, first_touch);
+    mScheduler.Reset(tick_rate_hz, FixedStepScheduler::Clock::now());
+    const double time_step = mScheduler.GetTimeStep();
+
+    try {
+        while (mRunning) {
+            mScheduler.WaitForNextDeadline();
+
+            const std::size_t due =
+                mScheduler.Advance(FixedStepScheduler::Clock::now());
+            for (std::size_t i = 0; i < due && mRunning; ++i) {
+                UpdateParticles(time_step);
+            }
+        }
+    } catch (...) {
+        // The loop ends; Stop() tears down and rethrows on its caller.
+        mLoopFailure = std::current_exception();
+        mRunning = false;
+    }
+}
+
+void Engine::CheckWorld(WorldId world) const {
+    if (world >= mWorlds.size()) {
+        throw std::out_of_range("World: " + std::to_string(world) +
+                                " does not exist");
+    }
+}
+
+void Engine::WorldLoop(WorldId world,
+                       const threading::ThreadPlacement& placement,
+                       bool first_touch) {
+    PlaceThread(placement);
+    if (first_touch) {
+        mWorlds[world]->FirstTouch(nullptr);
+    }
+
+    while (true) {
+        mStepStart->arrive_and_wait();
+        if (mWorldsStopping.load(std::memory_order_relaxed)) {
+            return;
+        }
+        try {
+            mWorlds[world]->Step(mWorldTimeStep, GetTickCount());
+        } catch (...) {
+            // Thrown from the loop thread after the step has joined.
+            mWorldFailures[world] = std::current_exception();
+        }
+        mStepDone->arrive_and_wait();
+    }
+}
+
+void Engine::PrepareLoopThread(const threading::ThreadPlacement& placement,
+                               bool first_touch) {
+    PlaceThread(placement);
+    if (first_touch) {
+        // With several worlds the pool is absent and the default world is
+        // stepped by this thread alone.
+        DefaultWorld().FirstTouch(mThreadPool.get());
+    }
+}
 
-        const auto end_time = std::chrono::steady_clock::now();
-        const auto elapsed = end_time - start_time;
-        const auto sleep_time = interval - elapsed;
+void Engine::PlaceThread(const threading::ThreadPlacement& placement) {
+    if (!threading::PlaceCurrentThread(placement)) {
+        mPlacementFailures.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void Engine::StartWorkers(const StartOptions& options) {
+    if (mWorlds.size() == 1) {
+        mThreadPool = std::make_unique<threading::ThreadPool>(
+            options.thread_count, options.worker_threads);
+        mPlacementFailures.fetch_add(mThreadPool->GetPlacementFailures(),
+                                     std::memory_order_relaxed);
+        return;
+    }
+
+    const auto participants = static_cast<std::ptrdiff_t>(mWorlds.size());
+    mStepStart = std::make_unique<std::barrier<>>(participants);
+    mStepDone = std::make_unique<std::barrier<>>(participants);
+    mWorldsStopping = false;
+    mWorldFailures.assign(mWorlds.size(), nullptr);
+    for (WorldId world = 1; world < mWorlds.size(); ++world) {
+        const threading::ThreadPlacement placement =
+            world - 1 < options.worker_threads.size()
+                ? options.worker_threads[world - 1]
+                : threading::ThreadPlacement{};
+        mWorldThreads.emplace_back(&Engine::WorldLoop, this, world,
+                                   placement, options.first_touch);
+    }
+}
+
+void Engine::StopWorkers() {
+    mThreadPool.reset();
+    if (mWorldThreads.empty()) {
+        return;
+    }
+
+    // No tick is in progress, so the world threads are all waiting for the
+    // next step; release them with the stop flag set.
+    mWorldsStopping = true;
+    mStepStart->arrive_and_wait();
+    for (std::thread& thread : mWorldThreads) {
+        thread.join();
+    }
+    mWorldThreads.clear();
+    mStepStart.reset();
+    mStepDone.reset();
+    mWorldFailures.clear();
+}
+
+void Engine::StepWorlds(double time_step) {
+    const std::uint64_t tick = GetTickCount();
+    if (mWorldThreads.empty()) {
+        for (const std::unique_ptr<World>& world : mWorlds) {
+            world->Step(time_step, tick, mThreadPool.get());
+        }
+    } else {
+        mWorldTimeStep = time_step;
+        mStepStart->arrive_and_wait();
+        try {
+            DefaultWorld().Step(time_step, tick);
+        } catch (...) {
+            // Let the other worlds finish the step, so the workers can
+            // still be stopped.
+            mStepDone->arrive_and_wait();
+            mWorldFailures.assign(mWorlds.size(), nullptr);
+            throw;
+        }
+        mStepDone->arrive_and_wait();
+        for (std::exception_ptr& failure : mWorldFailures) {
+            if (failure) {
+                std::exception_ptr thrown;
+                std::swap(thrown, failure);
+                std::rethrow_exception(thrown);
+            }
+        }
+    }
+
+    // The worlds step side by side, so the slowest one sets each stage.
+    WorldStepTimes slowest;
+    for (const std::unique_ptr<World>& world : mWorlds) {
+        const WorldStepTimes& times = world->GetLastStepTimes();
+        slowest.forces = std::max(slowest.forces, times.forces);
+        slowest.integrate = std::max(slowest.integrate, times.integrate);
+        slowest.broad_phase =
+            std::max(slowest.broad_phase, times.broad_phase);
+        slowest.spatial_index =
+            std::max(slowest.spatial_index, times.spatial_index);
+    }
+    mForceTimes.Record(slowest.forces);
+    mIntegrateTimes.Record(slowest.integrate);
+    mBroadPhaseTimes.Record(slowest.broad_phase);
+    mSpatialIndexTimes.Record(slowest.spatial_index);
+}
+
+void Engine::SyncPositions() {
+    for (const std::unique_ptr<World>& world : mWorlds) {
+        world->SyncPositions(mThreadPool.get());
+    }
+}
+
+void Engine::Submit(const Command& command) {
+    // Announce the push before looking at the flag, so EnterIdle() cannot
+    // drain the queue between the check and the push.
+    mPendingPushes.fetch_add(1);
+    if (!mLoopIdle.load()) {
+        while (!mCommands.TryPush(command)) {
+            std::this_thread::yield();
+        }
+        mPendingPushes.fetch_sub(1);
+        return;
+    }
+    mPendingPushes.fetch_sub(1);
+
+    const std::lock_guard<std::mutex> lock(mIdleMutex);
+    if (mLoopIdle.load()) {
+        ApplyCommand(command);
+        return;
+    }
+    while (!mCommands.TryPush(command)) {
+        std::this_thread::yield();
+    }
+}
+
+void Engine::LeaveIdle() {
+    const std::lock_guard<std::mutex> lock(mIdleMutex);
+    mLoopIdle = false;
+}
+
+void Engine::EnterIdle() {
+    const std::lock_guard<std::mutex> lock(mIdleMutex);
+    mLoopIdle = true;
+
+    // Producers that saw the loop live finish their push first; keep
+    // draining so one spinning on a full queue gets through.
+    while (mPendingPushes.load() > 0) {
+        ApplyCommands();
+        std::this_thread::yield();
+    }
+    ApplyCommands();
+}
+
+void Engine::ApplyCommand(const Command& command) {
+    if (command.type != CommandType::MigrateParticle) {
+        mWorlds[command.world]->ApplyCommand(command);
+        return;
+    }
+
+    // Migration is a removal from one world and an insertion into another,
+    // both made here between steps.
+    physics::ParticleStore& source = mWorlds[command.world]->GetParticles();
+    const auto particle = source.Find(command.handle);
+    if (!particle.has_value()) {
+        // The migration is dropped; the handle reserved for it stays
+        // invalid rather than leaking its slot.
+        mWorlds[command.value]->GetParticles().ReleaseHandle(command.target);
+        return;
+    }
+
+    Command insert;
+    insert.type = CommandType::AddParticle;
+    insert.world = command.value;
+    insert.handle = command.target;
+    insert.particle = particle->ToParticle();
+
+    Command remove;
+    remove.type = CommandType::RemoveParticle;
+    remove.world = command.world;
+    remove.handle = command.handle;
+    mWorlds[command.world]->ApplyCommand(remove);
+    mWorlds[insert.world]->ApplyCommand(insert);
+}
+
+void Engine::ApplyCommands() {
+    // Bound the batch so producers cannot keep the tick draining forever.
+    Command command;
+    for (std::size_t i = 0; i < mCommands.Capacity(); ++i) {
+        if (!mCommands.TryPop(command)) {
+            break;
+        }
+        ApplyCommand(command);
+    }
+}
+
+void Engine::PublishSnapshot() {
+    if (!mSnapshots) {
+        return;
+    }
+
+    ParticleSnapshot* snapshot = mSnapshots->BeginWrite();
+    if (snapshot == nullptr) {
+        return;
+    }
+
+    DefaultWorld().SyncPositions(mThreadPool.get());
+    const physics::ParticleStore& particles = DefaultWorld().GetParticles();
+    snapshot->Resize(particles.size());
+    threading::ParallelFor(
+        mThreadPool.get(), particles.size(), kParticleChunkSize,
+        [&particles, snapshot](std::size_t begin, std::size_t end) {
+            snapshot->CopyRange(particles, begin, end);
+        });
+    snapshot->SetTick(GetTickCount(), GetSimulationTime());
+
+    mSnapshots->CommitWrite();
+}
+
+void Engine::NotifyObservers() {
+    // Observers read the position columns directly.
+    for (const auto* observers : {&mLoopObservers, &mWorkerObservers}) {
+        for (const auto& entry : *observers) {
+            mWorlds[entry->observer.world]->SyncPositions(mThreadPool.get());
+        }
+    }
+
+    // One observer per chunk, so slow observers do not hold up each other.
+    // The pool must not see an exception; the first one is kept and
+    // rethrown once every chunk has finished.
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    threading::ParallelFor(
+        mThreadPool.get(), mWorkerObservers.size(), 1,
+        [this, &failure, &failure_mutex](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                try {
+                    CallObserver(*mWorkerObservers[i], &mPool);
+                } catch (...) {
+                    const std::lock_guard<std::mutex> lock(failure_mutex);
+                    if (!failure) {
+                        failure = std::current_exception();
+                    }
+                }
+            }
+        });
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+
+    for (const auto& entry : mLoopObservers) {
+        CallObserver(*entry, mTickArena.GetResource());
+    }
+}
+
+void Engine::CallObserver(ObserverEntry& entry,
+                          std::pmr::memory_resource* memory) {
+    const TickObserver& observer = entry.observer;
+    TickView view;
+    view.tick = GetTickCount();
+    view.simulation_time = GetSimulationTime();
+    view.world = observer.world;
+    view.particles = &mWorlds[observer.world]->GetParticles();
+    view.memory = memory;
+
+    if (observer.budget == 0) {
+        observer.function(observer.context, view);
+        return;
+    }
+
+    const Clock::time_point begin = Clock::now();
+    observer.function(observer.context, view);
+    if (ElapsedNanoseconds(begin, Clock::now()) > observer.budget) {
+        entry.overruns.fetch_add(1, std::memory_order_relaxed);
+        mObserverOverruns.fetch_add(1, std::memory_order_relaxed);
+    }
+}
 
-        if (sleep_time > std::chrono::nanoseconds(0)) {
-            std::this_thread::sleep_for(sleep_time);
+const Engine::ObserverEntry* Engine::FindObserver(ObserverId id) const {
+    for (const auto* observers : {&mLoopObservers, &mWorkerObservers}) {
+        for (const auto& entry : *observers) {
+            if (entry->id == id) {
+                return entry.get();
+            }
         }
     }
+    return nullptr;
 }
 
 }  // namespace engine
@@ -0,0 +1,95 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/FixedStepScheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace solo {
+namespace engine {
+
+FixedStepScheduler::FixedStepScheduler(std::size_t max_catch_up_ticks,
+                                       Clock::duration spin_window)
+    : mMaxCatchUpTicks(std::max<std::size_t>(max_catch_up_ticks, 1)),
+      mSpinWindow(spin_window) {}
+
+void FixedStepScheduler::Reset(double tick_rate_hz, Clock::time_point start) {
+    mTimeStep = 1.0 / tick_rate_hz;
+    mInterval = std::chrono::duration<double>(mTimeStep);
+    mEpoch = start;
+    mNextTickIndex = 0;
+}
+
+void FixedStepScheduler::WaitForNextDeadline() const {
+    const Clock::time_point deadline = GetNextDeadline();
+
+    // Hand the bulk of the wait to the OS, then spin through the last
+    // stretch where sleep granularity would make us late.
+    const Clock::time_point wake = deadline - mSpinWindow;
+    if (Clock::now() < wake) {
+        std::this_thread::sleep_until(wake);
+    }
+    while (Clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+std::size_t FixedStepScheduler::Advance(Clock::time_point now) {
+    if (now < GetNextDeadline()) {
+        return 0;
+    }
+
+    // Count every deadline that has passed, not just the next one.
+    const std::chrono::duration<double> behind = now - mEpoch;
+    const auto last_due = static_cast<std::uint64_t>(behind / mInterval);
+    const std::uint64_t due =
+        std::max<std::uint64_t>(last_due + 1, mNextTickIndex + 1) -
+        mNextTickIndex;
+    mNextTickIndex += due;
+
+    const std::uint64_t run = std::min<std::uint64_t>(due, mMaxCatchUpTicks);
+    if (due > 1) {
+        mMissedDeadlines.fetch_add(due - 1, std::memory_order_relaxed);
+        mCatchUpTicks.fetch_add(run - 1, std::memory_order_relaxed);
+        mDroppedTicks.fetch_add(due - run, std::memory_order_relaxed);
+    }
+    mTicks.fetch_add(run, std::memory_order_relaxed);
+
+    return static_cast<std::size_t>(run);
+}
+
+FixedStepScheduler::Clock::time_point FixedStepScheduler::GetNextDeadline()
+    const {
+    return DeadlineAt(mNextTickIndex);
+}
+
+SchedulerStats FixedStepScheduler::GetStats() const {
+    SchedulerStats stats;
+    stats.ticks = mTicks.load(std::memory_order_relaxed);
+    stats.missed_deadlines = mMissedDeadlines.load(std::memory_order_relaxed);
+    stats.catch_up_ticks = mCatchUpTicks.load(std::memory_order_relaxed);
+    stats.dropped_ticks = mDroppedTicks.load(std::memory_order_relaxed);
+    return stats;
+}
+
+FixedStepScheduler::Clock::time_point FixedStepScheduler::DeadlineAt(
+    std::uint64_t tick_index) const {
+    return mEpoch + std::chrono::duration_cast<Clock::duration>(
+                        mInterval * static_cast<double>(tick_index));
+}
+
+}  // namespace engine
+}  // namespace solo
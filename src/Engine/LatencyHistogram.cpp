@@ -0,0 +1,89 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/LatencyHistogram.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace solo {
+namespace engine {
+
+std::uint64_t LatencyHistogram::BucketUpperBound(std::size_t index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    const std::size_t shift = index / SUB_BUCKET_HALF - 1;
+    const std::uint64_t top = index % SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+    return ((top + 1) << shift) - 1;
+}
+
+LatencySummary LatencyHistogram::Summarize() const {
+    // Copy the counts once so every percentile sees the same distribution,
+    // and take the total from that copy rather than the racing counter.
+    std::array<std::uint64_t, BUCKET_COUNT> counts;
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+        counts[i] = mCounts[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+
+    LatencySummary summary;
+    summary.count = total;
+    summary.max = mMax.load(std::memory_order_relaxed);
+    if (total == 0) {
+        return summary;
+    }
+    summary.mean =
+        mSum.load(std::memory_order_relaxed) /
+        std::max<std::uint64_t>(mCount.load(std::memory_order_relaxed), 1);
+
+    const auto rank = [total](double quantile) {
+        const auto target = static_cast<std::uint64_t>(
+            std::ceil(quantile * static_cast<double>(total)));
+        return std::max<std::uint64_t>(target, 1);
+    };
+    const std::uint64_t p50_rank = rank(0.50);
+    const std::uint64_t p99_rank = rank(0.99);
+    const std::uint64_t p999_rank = rank(0.999);
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT && seen < p999_rank; ++i) {
+        if (counts[i] == 0) {
+            continue;
+        }
+        const std::uint64_t before = seen;
+        seen += counts[i];
+        // Report the bucket's upper edge, but never past the exact maximum.
+        const std::uint64_t value = std::min(BucketUpperBound(i), summary.max);
+        if (before < p50_rank && seen >= p50_rank) {
+            summary.p50 = value;
+        }
+        if (before < p99_rank && seen >= p99_rank) {
+            summary.p99 = value;
+        }
+        if (seen >= p999_rank) {
+            summary.p999 = value;
+        }
+    }
+
+    // The maximum is stored after the bucket, so a concurrent Record() may
+    // have been counted before its maximum became visible.
+    summary.max = std::max(summary.max, summary.p999);
+    return summary;
+}
+
+}  // namespace engine
+}  // namespace solo
@@ -0,0 +1,163 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/SnapshotBuffer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "Particle/ParticleStore.h"
+
+namespace solo {
+namespace engine {
+
+namespace {
+
+template <typename T>
+void ResizeColumns(physics::VectorColumns<T>& columns, std::size_t count) {
+    columns.x.resize(count);
+    columns.y.resize(count);
+    columns.z.resize(count);
+}
+
+template <typename T>
+void CopyColumns(const physics::VectorColumns<T>& source,
+                 physics::VectorColumns<T>& destination, std::size_t begin,
+                 std::size_t end) {
+    const auto first = static_cast<std::ptrdiff_t>(begin);
+    const auto last = static_cast<std::ptrdiff_t>(end);
+    std::copy(source.x.begin() + first, source.x.begin() + last,
+              destination.x.begin() + first);
+    std::copy(source.y.begin() + first, source.y.begin() + last,
+              destination.y.begin() + first);
+    std::copy(source.z.begin() + first, source.z.begin() + last,
+              destination.z.begin() + first);
+}
+
+}  // namespace
+
+void ParticleSnapshot::Resize(std::size_t count) {
+    mHandles.resize(count);
+    ResizeColumns(mPosition, count);
+    ResizeColumns(mVelocity, count);
+    ResizeColumns(mAngle, count);
+    ResizeColumns(mAngularVelocity, count);
+}
+
+void ParticleSnapshot::CopyRange(const physics::ParticleStore& store,
+                                 std::size_t begin, std::size_t end) {
+    const auto first = static_cast<std::ptrdiff_t>(begin);
+    const auto last = static_cast<std::ptrdiff_t>(end);
+    std::copy(store.Handles().begin() + first, store.Handles().begin() + last,
+              mHandles.begin() + first);
+    CopyColumns(store.Position(), mPosition, begin, end);
+    CopyColumns(store.Velocity(), mVelocity, begin, end);
+    CopyColumns(store.Angle(), mAngle, begin, end);
+    CopyColumns(store.AngularVelocity(), mAngularVelocity, begin, end);
+}
+
+void ParticleSnapshot::SetTick(std::uint64_t tick, double simulation_time) {
+    mTick = tick;
+    mSimulationTime = simulation_time;
+}
+
+PinnedSnapshot::PinnedSnapshot(std::atomic<std::int32_t>* pins,
+                               const ParticleSnapshot* snapshot)
+    : mPins(pins), mSnapshot(snapshot) {}
+
+PinnedSnapshot::~PinnedSnapshot() { Release(); }
+
+PinnedSnapshot::PinnedSnapshot(PinnedSnapshot&& other) noexcept
+    : mPins(std::exchange(other.mPins, nullptr)),
+      mSnapshot(std::exchange(other.mSnapshot, nullptr)) {}
+
+PinnedSnapshot& PinnedSnapshot::operator=(PinnedSnapshot&& other) noexcept {
+    if (this != &other) {
+        Release();
+        mPins = std::exchange(other.mPins, nullptr);
+        mSnapshot = std::exchange(other.mSnapshot, nullptr);
+    }
+    return *this;
+}
+
+void PinnedSnapshot::Release() {
+    if (mPins != nullptr) {
+        mPins->fetch_sub(1, std::memory_order_release);
+        mPins = nullptr;
+        mSnapshot = nullptr;
+    }
+}
+
+SnapshotBuffer::SnapshotBuffer(std::size_t slot_count)
+    : mSlotCount(std::max<std::size_t>(slot_count, 3)),
+      mSlots(std::make_unique<Slot[]>(mSlotCount)) {}
+
+ParticleSnapshot* SnapshotBuffer::BeginWrite() {
+    const std::size_t latest = mLatest.load(std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < mSlotCount; ++i) {
+        if (i == latest) {
+            continue;
+        }
+
+        // Only an unpinned slot may be claimed; acquire pairs with the
+        // release of the last reader so its reads finish before we write.
+        std::int32_t expected = 0;
+        if (mSlots[i].pins.compare_exchange_strong(expected, WRITER_PIN,
+                                                   std::memory_order_acquire,
+                                                   std::memory_order_relaxed)) {
+            mWriting = i;
+            return &mSlots[i].snapshot;
+        }
+    }
+
+    mSkippedWrites.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+void SnapshotBuffer::CommitWrite() {
+    if (mWriting == NO_SLOT) {
+        return;
+    }
+
+    mSlots[mWriting].pins.store(0, std::memory_order_release);
+    mLatest.store(mWriting, std::memory_order_release);
+    mWriting = NO_SLOT;
+}
+
+PinnedSnapshot SnapshotBuffer::Acquire() const {
+    while (true) {
+        const std::size_t latest = mLatest.load(std::memory_order_acquire);
+        if (latest == NO_SLOT) {
+            return {};
+        }
+
+        // A negative count means the writer reclaimed the slot after we
+        // read mLatest, so a newer snapshot is about to be published.
+        std::atomic<std::int32_t>& pins = mSlots[latest].pins;
+        std::int32_t count = pins.load(std::memory_order_relaxed);
+        while (count >= 0) {
+            if (pins.compare_exchange_weak(count, count + 1,
+                                           std::memory_order_acquire,
+                                           std::memory_order_relaxed)) {
+                return {&pins, &mSlots[latest].snapshot};
+            }
+        }
+    }
+}
+
+}  // namespace engine
+}  // namespace solo
@@ -0,0 +1,278 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/TelemetryWriter.h"
+
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "Engine/TickObserver.h"
+#include "Particle/ParticleStore.h"
+#include "Threading/SpscRing.h"
+
+namespace solo {
+namespace engine {
+
+namespace {
+
+// Pause of the writer thread when the ring is empty
+constexpr auto kIdleWait = std::chrono::milliseconds(1);
+
+// Room for the longest CSV line: three integers and four doubles, each at
+// most 24 characters, with separators
+constexpr std::size_t kMaxCsvLine = 192;
+
+constexpr char kCsvHeader[] = "tick,time,index,generation,x,y,z\n";
+
+template <typename T>
+void StoreRecord(TelemetryRecord& record, const T& value) {
+    std::memcpy(record.bytes, &value, sizeof(value));
+}
+
+template <typename T>
+T LoadRecord(const TelemetryRecord& record) {
+    T value;
+    std::memcpy(&value, record.bytes, sizeof(value));
+    return value;
+}
+
+/// @brief Writes count records into the ring as room appears, handing
+/// each contiguous span and the index of its first record to fill.
+template <typename Fill>
+void PushRecords(threading::SpscRing<TelemetryRecord>& ring,
+                 std::size_t count, const Fill& fill) {
+    std::size_t done = 0;
+    while (done < count) {
+        const std::span<TelemetryRecord> span = ring.BeginWrite(count - done);
+        if (span.empty()) {
+            std::this_thread::yield();
+            continue;
+        }
+        fill(span, done);
+        ring.CommitWrite(span.size());
+        done += span.size();
+    }
+}
+
+/// @brief Appends a number and a separator to a line buffer, which has
+/// room for the longest field.
+template <typename T>
+char* AppendField(char* out, char* end, T value, char separator) {
+    const std::to_chars_result result = std::to_chars(out, end - 1, value);
+    *result.ptr = separator;
+    return result.ptr + 1;
+}
+
+}  // namespace
+
+TelemetryWriter::TelemetryWriter(const std::filesystem::path& path,
+                                 const TelemetrySettings& settings)
+    : mSettings(settings),
+      mFile(path, std::ios::binary | std::ios::trunc),
+      mRing(settings.ring_capacity) {
+    if (!mFile) {
+        throw std::runtime_error("Cannot open telemetry file: " +
+                                 path.string());
+    }
+
+    if (mSettings.format == TelemetryFormat::Binary) {
+        mFile.write(TELEMETRY_MAGIC, sizeof(TELEMETRY_MAGIC));
+    } else {
+        mBatch.reserve(mSettings.batch_bytes + kMaxCsvLine);
+        mBatch.append(kCsvHeader);
+    }
+
+    mWriter = std::thread(&TelemetryWriter::WriterLoop, this);
+}
+
+TelemetryWriter::~TelemetryWriter() {
+    try {
+        Close();
+    } catch (const std::runtime_error&) {
+        // Lost telemetry can only be reported by an explicit Close().
+    }
+}
+
+void TelemetryWriter::Record(const TickView& view) {
+    // Announce the tick before looking at the flag: either Close() sees it
+    // and waits for it to be queued whole, or this sees the close.
+    mRecording.store(true);
+    if (mClosing.load()) {
+        mRecording.store(false, std::memory_order_release);
+        mDroppedTicks.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    RecordTick(view);
+    mRecording.store(false, std::memory_order_release);
+}
+
+void TelemetryWriter::RecordTick(const TickView& view) {
+    const physics::ParticleStore& particles = *view.particles;
+    const std::size_t count = particles.size();
+
+    // A tick is queued whole or not at all, so readers never see part of
+    // one.
+    if (mSettings.overflow == TelemetryOverflow::Drop &&
+        mRing.GetFreeCount() < count + 1) {
+        // A tick larger than the whole ring can never fit; Close() reports
+        // it, since every tick would be lost.
+        if (count + 1 > mRing.Capacity()) {
+            mOversizedTicks.fetch_add(1, std::memory_order_relaxed);
+        }
+        mDroppedTicks.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    TelemetryTick tick;
+    tick.tick = view.tick;
+    tick.simulation_time = view.simulation_time;
+    tick.particle_count = count;
+    PushRecords(mRing, 1,
+                [&tick](std::span<TelemetryRecord> span, std::size_t) {
+                    StoreRecord(span[0], tick);
+                });
+
+    const auto& handles = particles.Handles();
+    const physics::VectorColumns<double>& position = particles.Position();
+    PushRecords(mRing, count,
+                [&](std::span<TelemetryRecord> span, std::size_t first) {
+                    for (std::size_t k = 0; k < span.size(); ++k) {
+                        const std::size_t i = first + k;
+                        TelemetryParticle particle;
+                        particle.handle = handles[i];
+                        particle.x = position.x[i];
+                        particle.y = position.y[i];
+                        particle.z = position.z[i];
+                        StoreRecord(span[k], particle);
+                    }
+                });
+
+    mRecordedTicks.fetch_add(1, std::memory_order_relaxed);
+}
+
+TickObserver TelemetryWriter::GetObserver(WorldId world) {
+    TickObserver observer =
+        MakeTickObserver<&TelemetryWriter::Record>(*this);
+    observer.world = world;
+    return observer;
+}
+
+void TelemetryWriter::Close() {
+    if (!mWriter.joinable()) {
+        return;
+    }
+    mClosing.store(true);
+
+    // A tick already being recorded is finished first; the writer keeps
+    // draining meanwhile, so a blocked tick still gets through.
+    while (mRecording.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+    mFinishing.store(true, std::memory_order_release);
+    mWriter.join();
+    mFile.close();
+    if (!mFile) {
+        throw std::runtime_error("Failed to write telemetry file");
+    }
+    const std::uint64_t oversized = GetOversizedTicks();
+    if (oversized > 0) {
+        throw std::runtime_error(
+            std::to_string(oversized) +
+            " telemetry ticks were dropped for not fitting the ring of " +
+            std::to_string(mRing.Capacity()) + " records");
+    }
+}
+
+void TelemetryWriter::WriterLoop() {
+    while (true) {
+        const std::span<const TelemetryRecord> records = mRing.BeginRead();
+        if (records.empty()) {
+            // Finishing is set after the last record was published, so
+            // one more look once it is seen finds everything left.
+            if (mFinishing.load(std::memory_order_acquire)) {
+                if (mRing.BeginRead().empty()) {
+                    break;
+                }
+                continue;
+            }
+            std::this_thread::sleep_for(kIdleWait);
+            continue;
+        }
+
+        WriteRecords(records);
+        mRing.CommitRead(records.size());
+    }
+
+    FlushBatch();
+    mFile.flush();
+}
+
+void TelemetryWriter::WriteRecords(
+    std::span<const TelemetryRecord> records) {
+    if (mSettings.format == TelemetryFormat::Binary) {
+        // Everything drained goes out in one call, however many ticks it
+        // spans.
+        mFile.write(reinterpret_cast<const char*>(records.data()),
+                    static_cast<std::streamsize>(records.size_bytes()));
+        return;
+    }
+    FormatCsv(records);
+}
+
+void TelemetryWriter::FormatCsv(std::span<const TelemetryRecord> records) {
+    char line[kMaxCsvLine];
+    char* const end = line + kMaxCsvLine;
+
+    for (const TelemetryRecord& record : records) {
+        if (mCsvRowsLeft == 0) {
+            const auto tick = LoadRecord<TelemetryTick>(record);
+            mCsvTick = tick.tick;
+            mCsvTime = tick.simulation_time;
+            mCsvRowsLeft = tick.particle_count;
+            continue;
+        }
+
+        const auto particle = LoadRecord<TelemetryParticle>(record);
+        char* out = line;
+        out = AppendField(out, end, mCsvTick, ',');
+        out = AppendField(out, end, mCsvTime, ',');
+        out = AppendField(out, end, particle.handle.index, ',');
+        out = AppendField(out, end, particle.handle.generation, ',');
+        out = AppendField(out, end, particle.x, ',');
+        out = AppendField(out, end, particle.y, ',');
+        out = AppendField(out, end, particle.z, '\n');
+        mBatch.append(line, out);
+        --mCsvRowsLeft;
+
+        if (mBatch.size() >= mSettings.batch_bytes) {
+            FlushBatch();
+        }
+    }
+}
+
+void TelemetryWriter::FlushBatch() {
+    if (mBatch.empty()) {
+        return;
+    }
+    mFile.write(mBatch.data(), static_cast<std::streamsize>(mBatch.size()));
+    mBatch.clear();
+}
+
+}  // namespace engine
+}  // namespace solo
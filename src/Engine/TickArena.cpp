@@ -0,0 +1,75 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/TickArena.h"
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace solo {
+namespace engine {
+
+namespace {
+
+constexpr std::size_t kBufferAlignment = alignof(std::max_align_t);
+
+}  // namespace
+
+TickArena::TickArena(std::size_t capacity,
+                     std::pmr::memory_resource* upstream)
+    : mUpstream(upstream),
+      mOverflow(upstream),
+      mCapacity(capacity),
+      mBuffer(upstream->allocate(capacity, kBufferAlignment)) {
+    mArena.emplace(mBuffer, mCapacity, &mOverflow);
+}
+
+TickArena::~TickArena() {
+    mArena.reset();
+    mUpstream->deallocate(mBuffer, mCapacity, kBufferAlignment);
+}
+
+void TickArena::Reset() {
+    mArena->release();
+    if (mOverflow.GetBytes() == 0) {
+        return;
+    }
+
+    // The blocks the overflow took are at least what the tick needed past
+    // the buffer, so one regrowth usually covers a steady workload.
+    const std::size_t capacity = mCapacity + mOverflow.GetBytes();
+    mArena.reset();
+    mUpstream->deallocate(mBuffer, mCapacity, kBufferAlignment);
+    mBuffer = mUpstream->allocate(capacity, kBufferAlignment);
+    mCapacity = capacity;
+    mOverflow.Clear();
+    mArena.emplace(mBuffer, mCapacity, &mOverflow);
+}
+
+void* TickArena::OverflowResource::do_allocate(std::size_t bytes,
+                                               std::size_t alignment) {
+    mBytes += bytes;
+    return mUpstream->allocate(bytes, alignment);
+}
+
+void TickArena::OverflowResource::do_deallocate(void* pointer,
+                                                std::size_t bytes,
+                                                std::size_t alignment) {
+    mUpstream->deallocate(pointer, bytes, alignment);
+}
+
+bool TickArena::OverflowResource::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+}  // namespace engine
+}  // namespace solo
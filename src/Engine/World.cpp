@@ -0,0 +1,769 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/World.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Engine/Command.h"
+#include "Math/Vector.h"
+#include "Particle/ParticleStore.h"
+#include "Physics/BarnesHut.h"
+#include "Physics/BroadPhase.h"
+#include "Physics/ForceRegistry.h"
+#include "Physics/Integrators.h"
+#include "Physics/Morton.h"
+#include "Physics/RadixSort.h"
+#include "Physics/SpatialGrid.h"
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace engine {
+
+namespace {
+
+// Particles integrated per pool chunk. Large enough to amortise the
+// scheduling cost, small enough to leave chunks for stealing.
+constexpr std::size_t kParticleChunkSize = 8192;
+
+// Bits per axis of the Morton codes the store is sorted by. A thousand
+// cells a side already keeps neighbours within a few cache lines, and the
+// 30-bit codes sort in three radix passes rather than six.
+constexpr std::uint32_t kMortonSortBits = 10;
+
+/// @brief Advances one component of a position, velocity pair over the
+/// dense range [begin, end), the acceleration serving as its own history.
+/// The columns are restrict-qualified parameters rather than locals, which
+/// is what lets the compiler drop its aliasing checks and vectorise the
+/// loop; the integrator is a template policy, so each instantiation is a
+/// straight loop.
+/// @tparam Bounded Also check the positions against limit, as local frames
+/// need to find entries that left their region
+/// @return Nonzero if Bounded and a position ended beyond +-limit
+template <typename Integrator, bool Bounded, typename Position>
+unsigned StepComponent(Position* __restrict position,
+                       float* __restrict velocity,
+                       const float* __restrict acceleration,
+                       std::size_t begin, std::size_t end, float step,
+                       float limit) {
+    unsigned beyond = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+        Integrator::Step(position[i], velocity[i], acceleration[i],
+                         acceleration[i], step);
+        if constexpr (Bounded) {
+            beyond |= std::abs(position[i]) > limit ? 1u : 0u;
+        }
+    }
+    return beyond;
+}
+
+/// @brief StepComponent() for integrators that read the acceleration of
+/// the previous step, which is updated as it goes.
+template <typename Integrator, bool Bounded, typename Position>
+unsigned StepComponentWithHistory(Position* __restrict position,
+                                  float* __restrict velocity,
+                                  const float* __restrict acceleration,
+                                  float* __restrict previous,
+                                  std::size_t begin, std::size_t end,
+                                  float step, float limit) {
+    unsigned beyond = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+        // A particle's first step has no history; treat the acceleration
+        // as constant over it.
+        const float last =
+            std::isnan(previous[i]) ? acceleration[i] : previous[i];
+        Integrator::Step(position[i], velocity[i], acceleration[i], last,
+                         step);
+        previous[i] = acceleration[i];
+        if constexpr (Bounded) {
+            beyond |= std::abs(position[i]) > limit ? 1u : 0u;
+        }
+    }
+    return beyond;
+}
+
+/// @brief Integrates the linear motion of the dense range [begin, end)
+/// into the given position columns, either the store's double positions
+/// or its float local frames.
+/// @return True if Bounded and a position ended beyond +-limit
+template <typename Integrator, bool Bounded, typename Position>
+bool IntegrateLinear(physics::ParticleStore& store,
+                     physics::VectorColumns<Position>& position,
+                     const physics::VectorColumns<float>& acceleration,
+                     std::size_t begin, std::size_t end, float step,
+                     float limit) {
+    physics::VectorColumns<float>& velocity = store.Velocity();
+
+    unsigned beyond = 0;
+    if constexpr (Integrator::USES_HISTORY) {
+        physics::VectorColumns<float>& previous = store.PreviousAcceleration();
+        beyond |= StepComponentWithHistory<Integrator, Bounded>(
+            position.x.data(), velocity.x.data(), acceleration.x.data(),
+            previous.x.data(), begin, end, step, limit);
+        beyond |= StepComponentWithHistory<Integrator, Bounded>(
+            position.y.data(), velocity.y.data(), acceleration.y.data(),
+            previous.y.data(), begin, end, step, limit);
+        beyond |= StepComponentWithHistory<Integrator, Bounded>(
+            position.z.data(), velocity.z.data(), acceleration.z.data(),
+            previous.z.data(), begin, end, step, limit);
+    } else {
+        beyond |= StepComponent<Integrator, Bounded>(
+            position.x.data(), velocity.x.data(), acceleration.x.data(),
+            begin, end, step, limit);
+        beyond |= StepComponent<Integrator, Bounded>(
+            position.y.data(), velocity.y.data(), acceleration.y.data(),
+            begin, end, step, limit);
+        beyond |= StepComponent<Integrator, Bounded>(
+            position.z.data(), velocity.z.data(), acceleration.z.data(),
+            begin, end, step, limit);
+    }
+    return beyond != 0;
+}
+
+/// @brief Integrates the angular motion of the dense range [begin, end).
+/// Angular acceleration only changes when it is set, so it is its own
+/// history.
+template <typename Integrator>
+void IntegrateAngular(physics::ParticleStore& store, std::size_t begin,
+                      std::size_t end, float step) {
+    physics::VectorColumns<float>& angle = store.Angle();
+    physics::VectorColumns<float>& velocity = store.AngularVelocity();
+    const physics::VectorColumns<float>& acceleration =
+        store.AngularAcceleration();
+
+    StepComponent<Integrator, false>(angle.x.data(), velocity.x.data(),
+                                     acceleration.x.data(), begin, end, step,
+                                     0.0f);
+    StepComponent<Integrator, false>(angle.y.data(), velocity.y.data(),
+                                     acceleration.y.data(), begin, end, step,
+                                     0.0f);
+    StepComponent<Integrator, false>(angle.z.data(), velocity.z.data(),
+                                     acceleration.z.data(), begin, end, step,
+                                     0.0f);
+}
+
+/// @brief Integrates the dense range [begin, end) of the store columns.
+/// @param acceleration Linear acceleration to apply, either the store's own
+/// column or that plus the force stages
+template <typename Integrator>
+void IntegrateRange(physics::ParticleStore& store,
+                    const physics::VectorColumns<float>& acceleration,
+                    std::size_t begin, std::size_t end, double time_step) {
+    const float step = static_cast<float>(time_step);
+    IntegrateLinear<Integrator, false>(store, store.Position(), acceleration,
+                                       begin, end, step, 0.0f);
+    IntegrateAngular<Integrator>(store, begin, end, step);
+}
+
+/// @brief Integrates the dense range [begin, end) in the store's local
+/// frames. Every operand is a float, so the loops run at full SIMD width
+/// with no conversions; the same loops notice an entry a whole region from
+/// its origin, and the range is then rebased.
+template <typename Integrator>
+void IntegrateLocalRange(physics::ParticleStore& store,
+                         const physics::VectorColumns<float>& acceleration,
+                         std::size_t begin, std::size_t end,
+                         double time_step) {
+    const float step = static_cast<float>(time_step);
+    const auto limit = static_cast<float>(store.GetRegionSize());
+    if (IntegrateLinear<Integrator, true>(store, store.LocalPosition(),
+                                          acceleration, begin, end, step,
+                                          limit)) {
+        store.Rebase(begin, end);
+    }
+    IntegrateAngular<Integrator>(store, begin, end, step);
+}
+
+/// @brief Kernel instantiated for an integrator policy
+/// @param local_frames Integrate the store's local frames rather than its
+/// double positions
+World::IntegrateFunction SelectIntegrator(physics::IntegratorType type,
+                                          bool local_frames) {
+    switch (type) {
+        case physics::IntegratorType::VelocityVerlet:
+            return local_frames
+                       ? &IntegrateLocalRange<physics::VelocityVerlet>
+                       : &IntegrateRange<physics::VelocityVerlet>;
+        case physics::IntegratorType::RungeKutta4:
+            return local_frames ? &IntegrateLocalRange<physics::RungeKutta4>
+                                : &IntegrateRange<physics::RungeKutta4>;
+        case physics::IntegratorType::SymplecticEuler:
+        default:
+            return local_frames
+                       ? &IntegrateLocalRange<physics::SymplecticEuler>
+                       : &IntegrateRange<physics::SymplecticEuler>;
+    }
+}
+
+using Clock = std::chrono::steady_clock;
+
+/// @brief Nanoseconds between two clock readings.
+std::uint64_t ElapsedNanoseconds(Clock::time_point begin,
+                                 Clock::time_point end) {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin)
+            .count());
+}
+
+}  // namespace
+
+World::World(physics::IntegratorType integrator,
+             std::pmr::memory_resource* resource)
+    : mResource(resource),
+      mIntegratorType(integrator),
+      mIntegrate(SelectIntegrator(integrator, false)) {
+    AddRateGroup(1);
+}
+
+void World::Step(double time_step, std::uint64_t tick,
+                 threading::ThreadPool* pool) {
+    const Clock::time_point step_start = Clock::now();
+
+    mParticles.ApplyPendingWakes();
+    if (!mEmitters.empty()) {
+        UpdateEmitters(time_step);
+    }
+    mTime += time_step;
+    ScheduleGroups(tick);
+    const physics::VectorColumns<float>& acceleration = ApplyForces(pool);
+    const Clock::time_point forces_done = Clock::now();
+
+    if (mParticles.HasClosedFormMotion()) {
+        // Nothing is integrated; each particle's state follows from its
+        // reference state whenever it is read.
+        mParticles.AdvanceMotionTime(time_step);
+        mPositionsStale = true;
+    } else {
+        // Only the awake particles of the due groups are visited; each
+        // group is a contiguous range of the store.
+        for (const DueGroup& due : mDueGroups) {
+            IntegrateGroup(due, acceleration, pool);
+        }
+        mPositionsStale = mParticles.HasLocalFrames();
+        if (mSleep && !mGravity) {
+            UpdateSleep(acceleration, pool);
+        }
+    }
+    for (const DueGroup& due : mDueGroups) {
+        mGroupJoiners[due.group].clear();
+    }
+    if (mMortonCadence > 0 && tick % mMortonCadence == 0) {
+        SyncPositions(pool);
+        SortByMorton(pool);
+    }
+    const Clock::time_point integrate_done = Clock::now();
+
+    if (mBroadPhase || mSpatialIndex) {
+        SyncPositions(pool);
+    }
+    if (mBroadPhase) {
+        mBroadPhase->Update(mParticles, pool);
+        if (mCollisionCallback) {
+            mCollisionCallback(mBroadPhase->GetPairs());
+        }
+    }
+    const Clock::time_point broad_phase_done = Clock::now();
+
+    if (mSpatialIndex) {
+        mSpatialIndex->Build(mParticles, pool);
+    }
+    const Clock::time_point index_done = Clock::now();
+
+    mLastStepTimes.forces = ElapsedNanoseconds(step_start, forces_done);
+    mLastStepTimes.integrate = ElapsedNanoseconds(forces_done, integrate_done);
+    mLastStepTimes.broad_phase =
+        ElapsedNanoseconds(integrate_done, broad_phase_done);
+    mLastStepTimes.spatial_index =
+        ElapsedNanoseconds(broad_phase_done, index_done);
+}
+
+void World::FirstTouch(threading::ThreadPool* pool) {
+    mParticles.FirstTouch(pool, kParticleChunkSize);
+}
+
+void World::ApplyCommand(const Command& command) {
+    if (command.type == CommandType::AddParticle) {
+        mParticles.Insert(command.particle, command.handle);
+        AssignRateGroup(mParticles.IndexOf(command.handle), BASE_RATE_GROUP,
+                        mTime);
+        return;
+    }
+    if (command.type == CommandType::EmitBurst) {
+        EmitBurst(command.value, command.count);
+        return;
+    }
+
+    const std::size_t index = mParticles.IndexOf(command.handle);
+    if (index == physics::ParticleStore::NPOS) {
+        return;
+    }
+
+    switch (command.type) {
+        case CommandType::RemoveParticle:
+            LeaveRateGroup(index);
+            mParticles.RemoveAt(index);
+            break;
+        case CommandType::SetRateGroup:
+            AssignRateGroup(index, command.value, LeaveRateGroup(index));
+            break;
+        case CommandType::SetVelocity:
+            mParticles[index].SetVelocity(command.vector);
+            mParticles.Wake(index);
+            break;
+        case CommandType::SetAcceleration:
+            mParticles[index].SetAcceleration(command.vector);
+            mParticles.Wake(index);
+            break;
+        case CommandType::AddParticle:
+        case CommandType::MigrateParticle:
+        case CommandType::EmitBurst:
+        default:
+            break;
+    }
+}
+
+RateGroupId World::AddRateGroup(std::uint32_t divisor) {
+    if (divisor == 0) {
+        throw std::invalid_argument("Rate group divisor must be at least 1");
+    }
+
+    RateGroup group;
+    group.divisor = divisor;
+    group.first_group = static_cast<std::uint32_t>(mGroupOwners.size());
+    group.members.assign(divisor, 0);
+
+    const auto id = static_cast<RateGroupId>(mRateGroups.size());
+    mGroupOwners.insert(mGroupOwners.end(), divisor, id);
+    mGroupTimes.insert(mGroupTimes.end(), divisor, mTime);
+    mGroupJoiners.resize(mGroupOwners.size());
+    mRateGroups.push_back(std::move(group));
+    return id;
+}
+
+CheckpointSchedule World::GetSchedule() const {
+    CheckpointSchedule schedule;
+    schedule.world_time = mTime;
+    for (const RateGroup& group : mRateGroups) {
+        schedule.divisors.push_back(group.divisor);
+        schedule.phase_members.insert(schedule.phase_members.end(),
+                                      group.members.begin(),
+                                      group.members.end());
+    }
+    schedule.group_times = mGroupTimes;
+    for (std::uint32_t group = 0; group < mGroupJoiners.size(); ++group) {
+        for (const Joiner& joiner : mGroupJoiners[group]) {
+            schedule.joiner_groups.push_back(group);
+            schedule.joiner_handles.push_back(joiner.handle);
+            schedule.joiner_times.push_back(joiner.time);
+        }
+    }
+    schedule.emitter_time = mEmitters.GetTime();
+    schedule.expiries = mEmitters.GetExpiries();
+    return schedule;
+}
+
+void World::RestoreSchedule(const CheckpointSchedule& schedule) {
+    mTime = schedule.world_time;
+    std::size_t phase = 0;
+    for (RateGroup& group : mRateGroups) {
+        for (std::size_t& members : group.members) {
+            members = static_cast<std::size_t>(schedule.phase_members[phase]);
+            ++phase;
+        }
+    }
+    mGroupTimes = schedule.group_times;
+    for (std::vector<Joiner>& joiners : mGroupJoiners) {
+        joiners.clear();
+    }
+    for (std::size_t i = 0; i < schedule.joiner_groups.size(); ++i) {
+        mGroupJoiners[schedule.joiner_groups[i]].push_back(
+            Joiner{schedule.joiner_handles[i], schedule.joiner_times[i]});
+    }
+    mEmitters.RestoreLifetimes(schedule.expiries, schedule.emitter_time);
+}
+
+void World::SetIntegrator(physics::IntegratorType integrator) {
+    mIntegratorType = integrator;
+    mIntegrate = SelectIntegrator(integrator, mParticles.HasLocalFrames());
+    mParticles.ResetIntegratorHistory();
+}
+
+void World::EnableLocalFrames(double region_size) {
+    mParticles.EnableLocalFrames(region_size);
+    mIntegrate = SelectIntegrator(mIntegratorType, true);
+}
+
+void World::EnableClosedFormMotion() {
+    if (mGravity || !mForces.empty()) {
+        throw std::logic_error(
+            "Closed-form motion cannot follow force stages");
+    }
+    mParticles.EnableClosedFormMotion();
+}
+
+void World::SyncPositions(threading::ThreadPool* pool) {
+    if (!mPositionsStale) {
+        return;
+    }
+    threading::ParallelFor(pool, mParticles.size(), kParticleChunkSize,
+                           [this](std::size_t begin, std::size_t end) {
+                               mParticles.SyncPositions(begin, end);
+                           });
+    mPositionsStale = false;
+}
+
+void World::EnableSleeping(const SleepSettings& settings) {
+    mSleep = settings;
+}
+
+void World::EnableGravity(const physics::BarnesHutSettings& settings) {
+    if (mParticles.HasClosedFormMotion()) {
+        throw std::logic_error(
+            "Closed-form motion cannot follow force stages");
+    }
+    mGravity = std::make_unique<physics::BarnesHut>(settings, mResource);
+    mParticles.WakeAll();
+}
+
+physics::ForceGeneratorId World::AddForceGenerator(
+    const physics::ForceGenerator& generator) {
+    if (mParticles.HasClosedFormMotion()) {
+        throw std::logic_error(
+            "Closed-form motion cannot follow force stages");
+    }
+    WakeTagged(generator.tags);
+    return mForces.Add(generator);
+}
+
+bool World::RemoveForceGenerator(physics::ForceGeneratorId id) {
+    const physics::ForceGenerator* generator = mForces.Find(id);
+    if (generator == nullptr) {
+        return false;
+    }
+    WakeTagged(generator->tags);
+    return mForces.Remove(id);
+}
+
+physics::EmitterId World::AddEmitter(const physics::Emitter& emitter) {
+    return mEmitters.Add(emitter, mParticles);
+}
+
+bool World::RemoveEmitter(physics::EmitterId id) {
+    return mEmitters.Remove(id);
+}
+
+bool World::EmitBurst(physics::EmitterId id, std::size_t count) {
+    return mEmitters.Burst(id, count);
+}
+
+void World::EnableBroadPhase(CollisionCallback callback) {
+    mBroadPhase = std::make_unique<physics::BroadPhase>();
+    mCollisionCallback = std::move(callback);
+}
+
+const std::vector<physics::CollisionPair>& World::GetCollisionPairs() const {
+    return mBroadPhase ? mBroadPhase->GetPairs() : mNoCollisionPairs;
+}
+
+void World::EnableSpatialIndex(double cell_size) {
+    mSpatialIndex = std::make_unique<physics::SpatialGrid>(cell_size);
+}
+
+void World::EnableMortonOrder(std::uint32_t cadence) {
+    if (cadence == 0) {
+        throw std::invalid_argument("Morton order cadence must be at least 1");
+    }
+    mMortonCadence = cadence;
+}
+
+void World::ScheduleGroups(std::uint64_t tick) {
+    mDueGroups.clear();
+    for (const RateGroup& group : mRateGroups) {
+        DueGroup due;
+        due.group = group.first_group +
+                    static_cast<std::uint32_t>(tick % group.divisor);
+        // Normally divisor steps, but less for a phase whose members have
+        // not been advanced since the group was created or reset.
+        due.time_step = mTime - mGroupTimes[due.group];
+        mGroupTimes[due.group] = mTime;
+        mDueGroups.push_back(due);
+    }
+}
+
+void World::IntegrateGroup(const DueGroup& due,
+                           const physics::VectorColumns<float>& acceleration,
+                           threading::ThreadPool* pool) {
+    const auto integrate = [&](std::size_t first, std::size_t last,
+                               double time_step) {
+        threading::ParallelFor(
+            pool, last - first, kParticleChunkSize,
+            [&, first, time_step](std::size_t begin, std::size_t end) {
+                mIntegrate(mParticles, acceleration, first + begin,
+                           first + end, time_step);
+            });
+    };
+
+    const auto [first, last] = mParticles.GetGroupRange(due.group);
+    const std::vector<Joiner>& joiners = mGroupJoiners[due.group];
+    if (joiners.empty()) {
+        integrate(first, last, due.time_step);
+        return;
+    }
+
+    // Joiners are few; the runs of members between them step together.
+    // A joiner that has since been removed or put to sleep is skipped.
+    mJoinerSteps.clear();
+    for (const Joiner& joiner : joiners) {
+        const std::size_t index = mParticles.IndexOf(joiner.handle);
+        if (index >= first && index < last) {
+            mJoinerSteps.emplace_back(index, mTime - joiner.time);
+        }
+    }
+    std::sort(mJoinerSteps.begin(), mJoinerSteps.end());
+    std::size_t begin = first;
+    for (const auto& [index, time_step] : mJoinerSteps) {
+        integrate(begin, index, due.time_step);
+        integrate(index, index + 1, time_step);
+        begin = index + 1;
+    }
+    integrate(begin, last, due.time_step);
+}
+
+void World::AssignRateGroup(std::size_t index, RateGroupId group,
+                            double time) {
+    RateGroup& rate_group = mRateGroups[group];
+    const auto phase = static_cast<std::uint32_t>(std::distance(
+        rate_group.members.begin(),
+        std::min_element(rate_group.members.begin(),
+                         rate_group.members.end())));
+    ++rate_group.members[phase];
+    const std::uint32_t store_group = rate_group.first_group + phase;
+    mParticles.SetGroup(index, store_group);
+
+    // A particle whose state is not at the group's time catches up, or
+    // waits, at the group's next update.
+    if (time != mGroupTimes[store_group]) {
+        mGroupJoiners[store_group].push_back(
+            Joiner{mParticles.Handles()[index], time});
+    }
+}
+
+double World::LeaveRateGroup(std::size_t index) {
+    const std::uint32_t group = mParticles.Groups()[index];
+    if (group >= mGroupOwners.size()) {
+        return mTime;
+    }
+    RateGroup& rate_group = mRateGroups[mGroupOwners[group]];
+    std::size_t& members = rate_group.members[group - rate_group.first_group];
+    if (members > 0) {
+        --members;
+    }
+
+    std::vector<Joiner>& joiners = mGroupJoiners[group];
+    const physics::ParticleHandle handle = mParticles.Handles()[index];
+    const auto joiner =
+        std::find_if(joiners.begin(), joiners.end(),
+                     [handle](const Joiner& entry) {
+                         return entry.handle == handle;
+                     });
+    if (joiner == joiners.end()) {
+        return mGroupTimes[group];
+    }
+    const double time = joiner->time;
+    joiners.erase(joiner);
+    return time;
+}
+
+void World::UpdateEmitters(double time_step) {
+    // Particles removed by a command in the meantime are already gone.
+    const std::vector<physics::ParticleHandle>& expired = mEmitters.Expire();
+    for (const physics::ParticleHandle handle : expired) {
+        const std::size_t index = mParticles.IndexOf(handle);
+        if (index != physics::ParticleStore::NPOS) {
+            LeaveRateGroup(index);
+        }
+    }
+    mParticles.RemoveBatch(expired);
+
+    // Spawned particles land in the first store group, the base group's
+    // first phase.
+    mRateGroups[BASE_RATE_GROUP].members[0] +=
+        mEmitters.Spawn(mParticles, time_step);
+}
+
+void World::SortByMorton(threading::ThreadPool* pool) {
+    const std::size_t count = mParticles.size();
+    if (count < 2) {
+        return;
+    }
+    const physics::VectorColumns<double>& position = mParticles.Position();
+
+    const physics::MortonCube cube = physics::ComputeMortonCube(
+        mParticles, mMortonBounds, pool, kParticleChunkSize);
+    const double scale = cube.Scale(kMortonSortBits);
+
+    // The groups and the sleeping range are sorted apart so each stays
+    // contiguous.
+    for (std::uint32_t group = 0; group <= mParticles.GetGroupCount();
+         ++group) {
+        const auto [first, last] =
+            group < mParticles.GetGroupCount()
+                ? mParticles.GetGroupRange(group)
+                : std::pair{mParticles.GetAwakeCount(), count};
+        if (last - first < 2) {
+            continue;
+        }
+
+        mMortonOrder.resize(last - first);
+        threading::ParallelFor(
+            pool, last - first, kParticleChunkSize,
+            [&, first](std::size_t begin, std::size_t end) {
+                for (std::size_t k = begin; k < end; ++k) {
+                    const std::size_t i = first + k;
+                    mMortonOrder[k].code = physics::EncodeMorton(
+                        position.x[i] - cube.origin_x,
+                        position.y[i] - cube.origin_y,
+                        position.z[i] - cube.origin_z, scale);
+                    mMortonOrder[k].index = static_cast<std::uint32_t>(k);
+                }
+            });
+        physics::RadixSort(
+            mMortonOrder, mMortonScratch,
+            [](const MortonEntry& entry) { return entry.code; },
+            3 * kMortonSortBits, mRadixCounts, pool, kParticleChunkSize);
+
+        // Only the span between the first and last entry that moved is
+        // rewritten; between sorts most particles keep their place.
+        std::size_t moved_begin = 0;
+        std::size_t moved_end = mMortonOrder.size();
+        while (moved_begin < moved_end &&
+               mMortonOrder[moved_begin].index == moved_begin) {
+            ++moved_begin;
+        }
+        while (moved_end > moved_begin &&
+               mMortonOrder[moved_end - 1].index == moved_end - 1) {
+            --moved_end;
+        }
+        if (moved_begin == moved_end) {
+            continue;
+        }
+        mPermutation.resize(moved_end - moved_begin);
+        for (std::size_t k = moved_begin; k < moved_end; ++k) {
+            mPermutation[k - moved_begin] = static_cast<std::uint32_t>(
+                mMortonOrder[k].index - moved_begin);
+        }
+        mParticles.Reorder(first + moved_begin, mPermutation, pool,
+                           kParticleChunkSize);
+    }
+}
+
+const physics::VectorColumns<float>& World::ApplyForces(
+    threading::ThreadPool* pool) {
+    if (mForces.empty() && !mGravity) {
+        return mParticles.Acceleration();
+    }
+    SyncPositions(pool);
+
+    // Start from the particles' own acceleration and let each stage add
+    // to it, leaving the store column as the user set it. The generator
+    // sweep does the copy as it goes.
+    if (mForces.empty()) {
+        mNetAcceleration = mParticles.Acceleration();
+    } else {
+        for (const DueGroup& due : mDueGroups) {
+            const auto [first, last] = mParticles.GetGroupRange(due.group);
+            mForces.Apply(mParticles, first, last, mNetAcceleration, pool);
+        }
+    }
+    if (mGravity) {
+        mGravity->Accumulate(mParticles, mNetAcceleration, pool);
+    }
+    return mNetAcceleration;
+}
+
+void World::UpdateSleep(const physics::VectorColumns<float>& acceleration,
+                        threading::ThreadPool* pool) {
+    // Count first: the acceleration columns are indexed by the order the
+    // store had when the forces ran, which putting particles to sleep
+    // changes.
+    for (const DueGroup& due : mDueGroups) {
+        CountQuietUpdates(acceleration, due.group, pool);
+    }
+
+    for (const DueGroup& due : mDueGroups) {
+        // Walk down from the end of the group so each swap brings in an
+        // entry that has already been visited.
+        const auto [first, last] = mParticles.GetGroupRange(due.group);
+        const std::vector<std::uint32_t>& idle = mParticles.IdleTicks();
+        for (std::size_t i = last; i-- > first;) {
+            if (idle[i] >= mSleep->ticks) {
+                mParticles[i].SetVelocity(math::Vector(0.0f, 0.0f, 0.0f));
+                mParticles[i].SetAngularVelocity(
+                    math::Vector(0.0f, 0.0f, 0.0f));
+                mParticles.Sleep(i);
+            }
+        }
+    }
+}
+
+void World::CountQuietUpdates(
+    const physics::VectorColumns<float>& acceleration, std::uint32_t group,
+    threading::ThreadPool* pool) {
+    const float linear_squared =
+        mSleep->linear_threshold * mSleep->linear_threshold;
+    const float angular_squared =
+        mSleep->angular_threshold * mSleep->angular_threshold;
+
+    const auto [first, last] = mParticles.GetGroupRange(group);
+    threading::ParallelFor(
+        pool, last - first, kParticleChunkSize,
+        [&, first](std::size_t begin, std::size_t end) {
+            const auto squared = [](const physics::VectorColumns<float>& v,
+                                    std::size_t i) {
+                return v.x[i] * v.x[i] + v.y[i] * v.y[i] + v.z[i] * v.z[i];
+            };
+            std::vector<std::uint32_t>& idle = mParticles.IdleTicks();
+            for (std::size_t i = first + begin; i < first + end; ++i) {
+                const bool quiet =
+                    squared(mParticles.Velocity(), i) < linear_squared &&
+                    squared(acceleration, i) < linear_squared &&
+                    squared(mParticles.AngularVelocity(), i) <
+                        angular_squared &&
+                    squared(mParticles.AngularAcceleration(), i) <
+                        angular_squared;
+                idle[i] = quiet ? idle[i] + 1 : 0;
+            }
+        });
+}
+
+void World::WakeTagged(std::uint32_t tags) {
+    const std::vector<std::uint32_t>& particle_tags = mParticles.Tags();
+    for (std::size_t i = mParticles.GetAwakeCount(); i < mParticles.size();
+         ++i) {
+        if (tags == physics::ForceGenerator::ALL_PARTICLES ||
+            (particle_tags[i] & tags) != 0) {
+            mParticles.Wake(i);
+        }
+    }
+}
+
+}  // namespace engine
+}  // namespace solo
@@ -11,6 +11,8 @@
 
 #include "Particle/Particle.h"
 
+#include <cstdint>
+
 #include "Math/Vector.h"
 #include "Coordinates/WorldCoordinates.h"
 
@@ -53,13 +55,19 @@ void Particle::SetAngularAcceleration(
 
 void Particle::SetMass(double mass) { mMass = mass; }
 
+float Particle::GetRadius() const { return mRadius; }
+void Particle::SetRadius(float radius) { mRadius = radius; }
+
+std::uint32_t Particle::GetTags() const { return mTags; }
+void Particle::SetTags(std::uint32_t tags) { mTags = tags; }
+
 void Particle::Update(double time_step) {
     // Integrate linear motion
     mVelocity += mAcceleration * time_step;
     mPosition += mVelocity * time_step;
 
     // Integrate angular motion
-    mAngularVelocity += mAngularVelocity * time_step;
+    mAngularVelocity += mAngularAcceleration * time_step;
     mAngle += mAngularVelocity * time_step;
 }
 
@@ -0,0 +1,51 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Particle/ParticleHandle.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace solo {
+namespace physics {
+
+HandleAllocator::HandleAllocator(std::size_t recycle_capacity,
+                                 std::uint32_t first_index)
+    : mFree(recycle_capacity), mNextIndex(first_index) {}
+
+ParticleHandle HandleAllocator::Reserve() {
+    ParticleHandle handle;
+    if (mFree.TryPop(handle)) {
+        return handle;
+    }
+
+    handle.index = mNextIndex.fetch_add(1, std::memory_order_acq_rel);
+    handle.generation = 0;
+    return handle;
+}
+
+void HandleAllocator::Recycle(ParticleHandle handle) {
+    // Slots that did not fit last time go back first, oldest first.
+    std::size_t flushed = 0;
+    while (flushed < mOverflow.size() && mFree.TryPush(mOverflow[flushed])) {
+        ++flushed;
+    }
+    mOverflow.erase(mOverflow.begin(),
+                    mOverflow.begin() + static_cast<std::ptrdiff_t>(flushed));
+
+    if (!mOverflow.empty() || !mFree.TryPush(handle)) {
+        mOverflow.push_back(handle);
+    }
+}
+
+}  // namespace physics
+}  // namespace solo
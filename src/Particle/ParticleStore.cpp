@@ -0,0 +1,1228 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Particle/ParticleStore.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>  // NOLINT(misc-include-cleaner) std::to_string()
+#include <utility>
+#include <vector>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Math/Vector.h"
+#include "Particle/Particle.h"
+#include "Particle/ParticleHandle.h"
+#include "Threading/ThreadPlacement.h"
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace physics {
+
+namespace {
+
+// Marks a particle that has not been integrated yet.
+constexpr float kNoHistory = std::numeric_limits<float>::quiet_NaN();
+
+// Batches removing under this share of the store are cheaper one at a time
+// than as a pass over every entry.
+constexpr std::size_t kBatchRemovalDivisor = 16;
+
+void PushBack(VectorColumns<float>& columns, const math::Vector& value) {
+    columns.x.push_back(value.GetX());
+    columns.y.push_back(value.GetY());
+    columns.z.push_back(value.GetZ());
+}
+
+void PushBack(VectorColumns<double>& columns,
+              const math::WorldCoordinates& value) {
+    columns.x.push_back(value.GetX());
+    columns.y.push_back(value.GetY());
+    columns.z.push_back(value.GetZ());
+}
+
+void Append(VectorColumns<float>& columns, const math::Vector& value,
+            std::size_t count) {
+    columns.x.insert(columns.x.end(), count, value.GetX());
+    columns.y.insert(columns.y.end(), count, value.GetY());
+    columns.z.insert(columns.z.end(), count, value.GetZ());
+}
+
+void Append(VectorColumns<double>& columns,
+            const math::WorldCoordinates& value, std::size_t count) {
+    columns.x.insert(columns.x.end(), count, value.GetX());
+    columns.y.insert(columns.y.end(), count, value.GetY());
+    columns.z.insert(columns.z.end(), count, value.GetZ());
+}
+
+template <typename T>
+void Resize(VectorColumns<T>& columns, std::size_t size) {
+    columns.x.resize(size);
+    columns.y.resize(size);
+    columns.z.resize(size);
+}
+
+template <typename T>
+void Reserve(VectorColumns<T>& columns, std::size_t capacity) {
+    columns.x.reserve(capacity);
+    columns.y.reserve(capacity);
+    columns.z.reserve(capacity);
+}
+
+template <typename T>
+void FirstTouch(threading::ThreadPool* pool, VectorColumns<T>& columns,
+                std::size_t grain) {
+    threading::FirstTouch(pool, columns.x, grain);
+    threading::FirstTouch(pool, columns.y, grain);
+    threading::FirstTouch(pool, columns.z, grain);
+}
+
+template <typename T>
+void Clear(VectorColumns<T>& columns) {
+    columns.x.clear();
+    columns.y.clear();
+    columns.z.clear();
+}
+
+template <typename T>
+void SwapRemove(std::vector<T>& column, std::size_t index) {
+    column[index] = column.back();
+    column.pop_back();
+}
+
+template <typename T>
+void SwapRemove(VectorColumns<T>& columns, std::size_t index) {
+    SwapRemove(columns.x, index);
+    SwapRemove(columns.y, index);
+    SwapRemove(columns.z, index);
+}
+
+template <typename T>
+void SwapEntries(std::vector<T>& column, std::size_t first,
+                 std::size_t second) {
+    std::swap(column[first], column[second]);
+}
+
+template <typename T>
+void SwapEntries(VectorColumns<T>& columns, std::size_t first,
+                 std::size_t second) {
+    SwapEntries(columns.x, first, second);
+    SwapEntries(columns.y, first, second);
+    SwapEntries(columns.z, first, second);
+}
+
+template <typename T>
+void CopyEntry(std::vector<T>& column, std::size_t from, std::size_t to) {
+    column[to] = column[from];
+}
+
+template <typename T>
+void CopyEntry(VectorColumns<T>& columns, std::size_t from, std::size_t to) {
+    CopyEntry(columns.x, from, to);
+    CopyEntry(columns.y, from, to);
+    CopyEntry(columns.z, from, to);
+}
+
+/// @brief Rewrites column[begin + k] as the former column[begin + order[k]]
+template <typename T>
+void Gather(threading::ThreadPool* pool, std::vector<T>& column,
+            std::size_t begin, const std::vector<std::uint32_t>& order,
+            std::vector<T>& scratch, std::size_t grain) {
+    scratch.resize(order.size());
+    threading::ParallelFor(pool, order.size(), grain,
+                           [&](std::size_t first, std::size_t last) {
+                               for (std::size_t k = first; k < last; ++k) {
+                                   scratch[k] = column[begin + order[k]];
+                               }
+                           });
+    std::copy(scratch.begin(), scratch.end(),
+              column.begin() + static_cast<std::ptrdiff_t>(begin));
+}
+
+template <typename T>
+void Gather(threading::ThreadPool* pool, VectorColumns<T>& columns,
+            std::size_t begin, const std::vector<std::uint32_t>& order,
+            std::vector<T>& scratch, std::size_t grain) {
+    Gather(pool, columns.x, begin, order, scratch, grain);
+    Gather(pool, columns.y, begin, order, scratch, grain);
+    Gather(pool, columns.z, begin, order, scratch, grain);
+}
+
+math::Vector Read(const VectorColumns<float>& columns, std::size_t index) {
+    return {columns.x[index], columns.y[index], columns.z[index]};
+}
+
+void Write(VectorColumns<float>& columns, std::size_t index,
+           const math::Vector& value) {
+    columns.x[index] = value.GetX();
+    columns.y[index] = value.GetY();
+    columns.z[index] = value.GetZ();
+}
+
+void Write(VectorColumns<double>& columns, std::size_t index,
+           const math::WorldCoordinates& value) {
+    columns.x[index] = value.GetX();
+    columns.y[index] = value.GetY();
+    columns.z[index] = value.GetZ();
+}
+
+// The loop below takes restrict-qualified parameters, which the compiler
+// honours where it ignores restrict on locals, so it vectorises.
+
+/// @brief Writes origin plus offset over [begin, end)
+void AddOffsets(double* __restrict position, const double* __restrict origin,
+                const float* __restrict offset, std::size_t begin,
+                std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+        position[i] = origin[i] + static_cast<double>(offset[i]);
+    }
+}
+
+/// @brief One component of a quantity elapsed seconds past its reference
+/// value, its rate changing at a constant pace
+double ValueAt(double value, float rate, float change, double elapsed) {
+    return value + (static_cast<double>(rate) +
+                    0.5 * static_cast<double>(change) * elapsed) *
+                       elapsed;
+}
+
+/// @brief Rate of that component at the same time
+float RateAt(float rate, float change, double elapsed) {
+    return static_cast<float>(static_cast<double>(rate) +
+                              static_cast<double>(change) * elapsed);
+}
+
+/// @brief Writes one component of a quantity and its rate over
+/// [begin, end) at the given time, from their reference values
+template <typename T>
+void Extrapolate(T* __restrict value, float* __restrict rate,
+                 const T* __restrict reference_value,
+                 const float* __restrict reference_rate,
+                 const float* __restrict change,
+                 const double* __restrict reference_time, double time,
+                 std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+        const double elapsed = time - reference_time[i];
+        const auto start = static_cast<double>(reference_value[i]);
+        value[i] = static_cast<T>(
+            ValueAt(start, reference_rate[i], change[i], elapsed));
+        rate[i] = RateAt(reference_rate[i], change[i], elapsed);
+    }
+}
+
+/// @brief Extrapolate() over each component of a vector quantity
+template <typename T>
+void Extrapolate(VectorColumns<T>& value, VectorColumns<float>& rate,
+                 const VectorColumns<T>& reference_value,
+                 const VectorColumns<float>& reference_rate,
+                 const VectorColumns<float>& change,
+                 const std::vector<double>& reference_time, double time,
+                 std::size_t begin, std::size_t end) {
+    Extrapolate(value.x.data(), rate.x.data(), reference_value.x.data(),
+                reference_rate.x.data(), change.x.data(),
+                reference_time.data(), time, begin, end);
+    Extrapolate(value.y.data(), rate.y.data(), reference_value.y.data(),
+                reference_rate.y.data(), change.y.data(),
+                reference_time.data(), time, begin, end);
+    Extrapolate(value.z.data(), rate.z.data(), reference_value.z.data(),
+                reference_rate.z.data(), change.z.data(),
+                reference_time.data(), time, begin, end);
+}
+
+/// @brief A float vector quantity of one entry elapsed seconds past its
+/// reference value
+math::Vector ValueAt(const VectorColumns<float>& value,
+                     const VectorColumns<float>& rate,
+                     const VectorColumns<float>& change, std::size_t index,
+                     double elapsed) {
+    const auto at = [&](const std::vector<float>& v,
+                        const std::vector<float>& r,
+                        const std::vector<float>& c) {
+        return static_cast<float>(ValueAt(static_cast<double>(v[index]),
+                                          r[index], c[index], elapsed));
+    };
+    return {at(value.x, rate.x, change.x), at(value.y, rate.y, change.y),
+            at(value.z, rate.z, change.z)};
+}
+
+/// @brief The rate of that quantity at the same time
+math::Vector RateAt(const VectorColumns<float>& rate,
+                    const VectorColumns<float>& change, std::size_t index,
+                    double elapsed) {
+    return {RateAt(rate.x[index], change.x[index], elapsed),
+            RateAt(rate.y[index], change.y[index], elapsed),
+            RateAt(rate.z[index], change.z[index], elapsed)};
+}
+
+/// @brief Moves one coordinate of a local frame onto the region it has
+/// strayed into, if it lies more than limit from its origin
+/// @return True if the coordinate moved
+bool RebaseComponent(float& local, double& origin, float limit,
+                     double region_size) {
+    if (std::abs(local) <= limit) {
+        return false;
+    }
+    const double shift =
+        std::round(static_cast<double>(local) / region_size) * region_size;
+    origin += shift;
+    local = static_cast<float>(static_cast<double>(local) - shift);
+    return true;
+}
+
+/// @brief Origin of the region holding a coordinate, the nearest multiple
+/// of the region size
+double RegionOrigin(double coordinate, double region_size) {
+    return std::round(coordinate / region_size) * region_size;
+}
+
+}  // namespace
+
+ParticleRef::ParticleRef(ParticleStore& store, std::size_t index)
+    : mStore(&store), mIndex(index) {}
+
+double ParticleRef::GetMass() const { return mStore->Mass()[mIndex]; }
+
+math::WorldCoordinates ParticleRef::GetPosition() const {
+    return mStore->GetPosition(mIndex);
+}
+math::Vector ParticleRef::GetVelocity() const {
+    return mStore->GetVelocity(mIndex);
+}
+math::Vector ParticleRef::GetAcceleration() const {
+    return Read(mStore->Acceleration(), mIndex);
+}
+
+math::Vector ParticleRef::GetAngle() const {
+    return mStore->GetAngle(mIndex);
+}
+math::Vector ParticleRef::GetAngularVelocity() const {
+    return mStore->GetAngularVelocity(mIndex);
+}
+math::Vector ParticleRef::GetAngularAcceleration() const {
+    return Read(mStore->AngularAcceleration(), mIndex);
+}
+
+float ParticleRef::GetRadius() const { return mStore->Radius()[mIndex]; }
+std::uint32_t ParticleRef::GetTags() const { return mStore->Tags()[mIndex]; }
+
+void ParticleRef::SetMass(double mass) { mStore->Mass()[mIndex] = mass; }
+
+void ParticleRef::SetPosition(const math::WorldCoordinates& position) {
+    mStore->SetPosition(mIndex, position);
+}
+void ParticleRef::SetVelocity(const math::Vector& velocity) {
+    mStore->SetVelocity(mIndex, velocity);
+}
+void ParticleRef::SetAcceleration(const math::Vector& acceleration) {
+    mStore->SetAcceleration(mIndex, acceleration);
+}
+
+void ParticleRef::SetAngle(const math::Vector& angle) {
+    mStore->SetAngle(mIndex, angle);
+}
+void ParticleRef::SetAngularVelocity(const math::Vector& angular_velocity) {
+    mStore->SetAngularVelocity(mIndex, angular_velocity);
+}
+void ParticleRef::SetAngularAcceleration(
+    const math::Vector& angular_acceleration) {
+    mStore->SetAngularAcceleration(mIndex, angular_acceleration);
+}
+
+void ParticleRef::SetRadius(float radius) {
+    mStore->Radius()[mIndex] = radius;
+}
+void ParticleRef::SetTags(std::uint32_t tags) {
+    mStore->Tags()[mIndex] = tags;
+}
+
+ParticleHandle ParticleRef::GetHandle() const {
+    return mStore->GetHandle(mIndex);
+}
+
+Particle ParticleRef::ToParticle() const { return mStore->Get(mIndex); }
+
+ParticleStore::ParticleStore()
+    : mAllocator(std::make_unique<HandleAllocator>()) {}
+
+ParticleHandle ParticleStore::Add(const Particle& particle) {
+    const ParticleHandle handle = mAllocator->Reserve();
+    Insert(particle, handle);
+    return handle;
+}
+
+ParticleHandle ParticleStore::ReserveHandle() { return mAllocator->Reserve(); }
+
+void ParticleStore::Insert(const Particle& particle, ParticleHandle handle) {
+    if (handle.index >= mSlots.size()) {
+        mSlots.resize(static_cast<std::size_t>(handle.index) + 1);
+    }
+    Slot& slot = mSlots[handle.index];
+    slot.dense = static_cast<std::uint32_t>(size());
+    slot.generation = handle.generation;
+    mHandles.push_back(handle);
+
+    mMass.push_back(particle.GetMass());
+    PushBack(mPosition, particle.GetPosition());
+    PushBack(mVelocity, particle.GetVelocity());
+    PushBack(mAcceleration, particle.GetAcceleration());
+    PushBack(mAngle, particle.GetAngle());
+    PushBack(mAngularVelocity, particle.GetAngularVelocity());
+    PushBack(mAngularAcceleration, particle.GetAngularAcceleration());
+    mRadius.push_back(particle.GetRadius());
+    mTags.push_back(particle.GetTags());
+    PushBack(mPreviousAcceleration,
+             math::Vector(kNoHistory, kNoHistory, kNoHistory));
+    mIdleTicks.push_back(0);
+    mGroups.push_back(0);
+    if (HasLocalFrames()) {
+        PushBack(mLocalPosition, math::Vector());
+        PushBack(mOrigin, math::WorldCoordinates());
+        PlaceInRegion(size() - 1, particle.GetPosition());
+    }
+    if (HasClosedFormMotion()) {
+        PushBack(mReferencePosition, particle.GetPosition());
+        PushBack(mReferenceVelocity, particle.GetVelocity());
+        PushBack(mReferenceAngle, particle.GetAngle());
+        PushBack(mReferenceAngularVelocity, particle.GetAngularVelocity());
+        mReferenceTime.push_back(mMotionTime);
+    }
+
+    // New particles start awake, in the first group.
+    Wake(size() - 1);
+}
+
+std::pair<std::size_t, std::size_t> ParticleStore::AddCopies(
+    const Particle& particle, std::size_t count) {
+    const std::size_t first = size();
+    for (std::size_t i = 0; i < count; ++i) {
+        const ParticleHandle handle = mAllocator->Reserve();
+        if (handle.index >= mSlots.size()) {
+            mSlots.resize(static_cast<std::size_t>(handle.index) + 1);
+        }
+        Slot& slot = mSlots[handle.index];
+        slot.dense = static_cast<std::uint32_t>(first + i);
+        slot.generation = handle.generation;
+        mHandles.push_back(handle);
+    }
+
+    mMass.insert(mMass.end(), count, particle.GetMass());
+    Append(mPosition, particle.GetPosition(), count);
+    Append(mVelocity, particle.GetVelocity(), count);
+    Append(mAcceleration, particle.GetAcceleration(), count);
+    Append(mAngle, particle.GetAngle(), count);
+    Append(mAngularVelocity, particle.GetAngularVelocity(), count);
+    Append(mAngularAcceleration, particle.GetAngularAcceleration(), count);
+    mRadius.insert(mRadius.end(), count, particle.GetRadius());
+    mTags.insert(mTags.end(), count, particle.GetTags());
+    Append(mPreviousAcceleration,
+           math::Vector(kNoHistory, kNoHistory, kNoHistory), count);
+    mIdleTicks.insert(mIdleTicks.end(), count, 0);
+    mGroups.insert(mGroups.end(), count, 0);
+    if (HasLocalFrames()) {
+        Resize(mLocalPosition, size());
+        Resize(mOrigin, size());
+        for (std::size_t i = first; i < size(); ++i) {
+            PlaceInRegion(i, particle.GetPosition());
+        }
+    }
+    if (HasClosedFormMotion()) {
+        Append(mReferencePosition, particle.GetPosition(), count);
+        Append(mReferenceVelocity, particle.GetVelocity(), count);
+        Append(mReferenceAngle, particle.GetAngle(), count);
+        Append(mReferenceAngularVelocity, particle.GetAngularVelocity(),
+               count);
+        mReferenceTime.insert(mReferenceTime.end(), count, mMotionTime);
+    }
+
+    // The copies trail the sleeping range. Move them into the first group
+    // as one block, a range at a time from the last: exchange the block
+    // with the head of its range, which costs no more swaps than the range
+    // has other entries, then move the range's start past the block. It
+    // is then the tail of the range before.
+    for (std::size_t group = GetGroupCount(); group > 0; --group) {
+        const std::size_t begin = mGroupStart[group];
+        const std::size_t end =
+            group < GetGroupCount() ? mGroupStart[group + 1] : size();
+        const std::size_t swaps = std::min(count, end - begin - count);
+        for (std::size_t i = 0; i < swaps; ++i) {
+            Swap(begin + i, end - swaps + i);
+        }
+        mGroupStart[group] += count;
+    }
+    return {mGroupStart[1] - count, mGroupStart[1]};
+}
+
+void ParticleStore::ReleaseHandle(ParticleHandle handle) {
+    if (handle.index >= mSlots.size()) {
+        mSlots.resize(static_cast<std::size_t>(handle.index) + 1);
+    }
+    // Retire the slot as a removal would, so the handle never comes back.
+    mSlots[handle.index].dense = NO_ENTRY;
+    ++handle.generation;
+    mSlots[handle.index].generation = handle.generation;
+    mAllocator->Recycle(handle);
+}
+
+bool ParticleStore::Remove(ParticleHandle handle) {
+    const std::size_t index = IndexOf(handle);
+    if (index == NPOS) {
+        return false;
+    }
+    RemoveAt(index);
+    return true;
+}
+
+void ParticleStore::RemoveAt(std::size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("Particle index: " + std::to_string(index) +
+                                " is out of range");
+    }
+
+    // Move the hole out of the awake groups first so the partitions
+    // survive the swap with the last entry.
+    index = Sleep(index);
+
+    ParticleHandle removed = mHandles[index];
+
+    // The last entry moves into the hole.
+    mSlots[mHandles.back().index].dense = static_cast<std::uint32_t>(index);
+    SwapRemove(mHandles, index);
+
+    // Retire the slot; the bumped generation invalidates outstanding handles.
+    mSlots[removed.index].dense = NO_ENTRY;
+    ++removed.generation;
+    mSlots[removed.index].generation = removed.generation;
+    mAllocator->Recycle(removed);
+
+    SwapRemove(mMass, index);
+    SwapRemove(mPosition, index);
+    SwapRemove(mVelocity, index);
+    SwapRemove(mAcceleration, index);
+    SwapRemove(mAngle, index);
+    SwapRemove(mAngularVelocity, index);
+    SwapRemove(mAngularAcceleration, index);
+    SwapRemove(mRadius, index);
+    SwapRemove(mTags, index);
+    SwapRemove(mPreviousAcceleration, index);
+    SwapRemove(mIdleTicks, index);
+    SwapRemove(mGroups, index);
+    if (HasLocalFrames()) {
+        SwapRemove(mLocalPosition, index);
+        SwapRemove(mOrigin, index);
+    }
+    if (HasClosedFormMotion()) {
+        SwapRemove(mReferencePosition, index);
+        SwapRemove(mReferenceVelocity, index);
+        SwapRemove(mReferenceAngle, index);
+        SwapRemove(mReferenceAngularVelocity, index);
+        SwapRemove(mReferenceTime, index);
+    }
+}
+
+std::size_t ParticleStore::RemoveBatch(
+    const std::vector<ParticleHandle>& handles) {
+    std::size_t removed = 0;
+    if (handles.size() * kBatchRemovalDivisor < size()) {
+        for (const ParticleHandle handle : handles) {
+            removed += Remove(handle) ? 1 : 0;
+        }
+        return removed;
+    }
+
+    // Retire the slots first; a retired slot then marks its entry.
+    for (ParticleHandle handle : handles) {
+        if (IndexOf(handle) == NPOS) {
+            continue;
+        }
+        mSlots[handle.index].dense = NO_ENTRY;
+        ++handle.generation;
+        mSlots[handle.index].generation = handle.generation;
+        mAllocator->Recycle(handle);
+        ++removed;
+    }
+
+    // Survivors slide down in order, so every group stays contiguous and
+    // only its boundaries move.
+    std::size_t write = 0;
+    std::size_t boundary = 1;
+    for (std::size_t read = 0; read < size(); ++read) {
+        while (boundary < mGroupStart.size() &&
+               mGroupStart[boundary] == read) {
+            mGroupStart[boundary++] = write;
+        }
+        if (mSlots[mHandles[read].index].dense == NO_ENTRY) {
+            continue;
+        }
+        if (write != read) {
+            MoveEntry(read, write);
+        }
+        ++write;
+    }
+    while (boundary < mGroupStart.size()) {
+        mGroupStart[boundary++] = write;
+    }
+
+    mHandles.resize(write);
+    mMass.resize(write);
+    Resize(mPosition, write);
+    Resize(mVelocity, write);
+    Resize(mAcceleration, write);
+    Resize(mAngle, write);
+    Resize(mAngularVelocity, write);
+    Resize(mAngularAcceleration, write);
+    mRadius.resize(write);
+    mTags.resize(write);
+    Resize(mPreviousAcceleration, write);
+    mIdleTicks.resize(write);
+    mGroups.resize(write);
+    if (HasLocalFrames()) {
+        Resize(mLocalPosition, write);
+        Resize(mOrigin, write);
+    }
+    if (HasClosedFormMotion()) {
+        Resize(mReferencePosition, write);
+        Resize(mReferenceVelocity, write);
+        Resize(mReferenceAngle, write);
+        Resize(mReferenceAngularVelocity, write);
+        mReferenceTime.resize(write);
+    }
+    return removed;
+}
+
+void ParticleStore::Swap(std::size_t first, std::size_t second) {
+    if (first == second) {
+        return;
+    }
+
+    mSlots[mHandles[first].index].dense = static_cast<std::uint32_t>(second);
+    mSlots[mHandles[second].index].dense = static_cast<std::uint32_t>(first);
+    SwapEntries(mHandles, first, second);
+
+    SwapEntries(mMass, first, second);
+    SwapEntries(mPosition, first, second);
+    SwapEntries(mVelocity, first, second);
+    SwapEntries(mAcceleration, first, second);
+    SwapEntries(mAngle, first, second);
+    SwapEntries(mAngularVelocity, first, second);
+    SwapEntries(mAngularAcceleration, first, second);
+    SwapEntries(mRadius, first, second);
+    SwapEntries(mTags, first, second);
+    SwapEntries(mPreviousAcceleration, first, second);
+    SwapEntries(mIdleTicks, first, second);
+    SwapEntries(mGroups, first, second);
+    if (HasLocalFrames()) {
+        SwapEntries(mLocalPosition, first, second);
+        SwapEntries(mOrigin, first, second);
+    }
+    if (HasClosedFormMotion()) {
+        SwapEntries(mReferencePosition, first, second);
+        SwapEntries(mReferenceVelocity, first, second);
+        SwapEntries(mReferenceAngle, first, second);
+        SwapEntries(mReferenceAngularVelocity, first, second);
+        SwapEntries(mReferenceTime, first, second);
+    }
+}
+
+std::size_t ParticleStore::Wake(std::size_t index) {
+    mIdleTicks[index] = 0;
+    if (IsAwake(index)) {
+        return index;
+    }
+    return MoveAcrossGroups(index, GetGroupCount(), mGroups[index]);
+}
+
+std::size_t ParticleStore::Sleep(std::size_t index) {
+    if (!IsAwake(index)) {
+        return index;
+    }
+    return MoveAcrossGroups(index, mGroups[index], GetGroupCount());
+}
+
+void ParticleStore::WakeAll() {
+    // Each wake leaves the next sleeper at the boundary.
+    for (std::size_t index = GetAwakeCount(); index < size(); ++index) {
+        Wake(index);
+    }
+    std::fill(mIdleTicks.begin(), mIdleTicks.end(), 0);
+    mPendingWakes.clear();
+}
+
+void ParticleStore::ApplyPendingWakes() {
+    for (ParticleHandle handle : mPendingWakes) {
+        // The entry may have been removed, or woken already.
+        const std::size_t index = IndexOf(handle);
+        if (index != NPOS) {
+            Wake(index);
+        }
+    }
+    mPendingWakes.clear();
+}
+
+void ParticleStore::MarkMoved(std::size_t index) {
+    mIdleTicks[index] = 0;
+    if (!IsAwake(index)) {
+        mPendingWakes.push_back(mHandles[index]);
+    }
+}
+
+std::size_t ParticleStore::SetGroup(std::size_t index, std::uint32_t group) {
+    if (group >= GetGroupCount()) {
+        // New groups start empty at the end of the awake range.
+        mGroupStart.insert(mGroupStart.end() - 1,
+                           group + 1 - GetGroupCount(), mGroupStart.back());
+    }
+    if (IsAwake(index)) {
+        index = MoveAcrossGroups(index, mGroups[index], group);
+    }
+    mGroups[index] = group;
+    return index;
+}
+
+std::pair<std::size_t, std::size_t> ParticleStore::GetGroupRange(
+    std::uint32_t group) const {
+    if (group >= GetGroupCount()) {
+        return {GetAwakeCount(), GetAwakeCount()};
+    }
+    return {mGroupStart[group], mGroupStart[group + 1]};
+}
+
+std::size_t ParticleStore::MoveAcrossGroups(std::size_t index,
+                                            std::size_t from,
+                                            std::size_t to) {
+    // Cross one boundary at a time: exchange with the entry at the edge of
+    // the current group, then move the boundary over the entry. Group
+    // GetGroupCount() stands for the sleeping range.
+    while (from < to) {
+        const std::size_t last = mGroupStart[from + 1] - 1;
+        Swap(index, last);
+        index = last;
+        --mGroupStart[from + 1];
+        ++from;
+    }
+    while (from > to) {
+        const std::size_t first = mGroupStart[from];
+        Swap(index, first);
+        index = first;
+        ++mGroupStart[from];
+        --from;
+    }
+    return index;
+}
+
+void ParticleStore::Reserve(std::size_t capacity) {
+    mSlots.reserve(capacity);
+    mHandles.reserve(capacity);
+    mMass.reserve(capacity);
+    physics::Reserve(mPosition, capacity);
+    physics::Reserve(mVelocity, capacity);
+    physics::Reserve(mAcceleration, capacity);
+    physics::Reserve(mAngle, capacity);
+    physics::Reserve(mAngularVelocity, capacity);
+    physics::Reserve(mAngularAcceleration, capacity);
+    mRadius.reserve(capacity);
+    mTags.reserve(capacity);
+    physics::Reserve(mPreviousAcceleration, capacity);
+    mIdleTicks.reserve(capacity);
+    mGroups.reserve(capacity);
+    if (HasLocalFrames()) {
+        physics::Reserve(mLocalPosition, capacity);
+        physics::Reserve(mOrigin, capacity);
+    }
+    if (HasClosedFormMotion()) {
+        physics::Reserve(mReferencePosition, capacity);
+        physics::Reserve(mReferenceVelocity, capacity);
+        physics::Reserve(mReferenceAngle, capacity);
+        physics::Reserve(mReferenceAngularVelocity, capacity);
+        mReferenceTime.reserve(capacity);
+    }
+}
+
+void ParticleStore::FirstTouch(threading::ThreadPool* pool,
+                               std::size_t grain) {
+    // The slot map is only used by commands on the loop thread.
+    threading::FirstTouch(pool, mMass, grain);
+    physics::FirstTouch(pool, mPosition, grain);
+    physics::FirstTouch(pool, mVelocity, grain);
+    physics::FirstTouch(pool, mAcceleration, grain);
+    physics::FirstTouch(pool, mAngle, grain);
+    physics::FirstTouch(pool, mAngularVelocity, grain);
+    physics::FirstTouch(pool, mAngularAcceleration, grain);
+    threading::FirstTouch(pool, mRadius, grain);
+    threading::FirstTouch(pool, mTags, grain);
+    physics::FirstTouch(pool, mPreviousAcceleration, grain);
+    threading::FirstTouch(pool, mIdleTicks, grain);
+    physics::FirstTouch(pool, mLocalPosition, grain);
+    physics::FirstTouch(pool, mOrigin, grain);
+    physics::FirstTouch(pool, mReferencePosition, grain);
+    physics::FirstTouch(pool, mReferenceVelocity, grain);
+    physics::FirstTouch(pool, mReferenceAngle, grain);
+    physics::FirstTouch(pool, mReferenceAngularVelocity, grain);
+    threading::FirstTouch(pool, mReferenceTime, grain);
+}
+
+void ParticleStore::Reorder(std::size_t begin,
+                            const std::vector<std::uint32_t>& order,
+                            threading::ThreadPool* pool, std::size_t grain) {
+    if (begin + order.size() > size()) {
+        throw std::out_of_range("Reorder range ends past the last entry");
+    }
+
+    // One scratch column per element type, reused across the columns and
+    // kept for the next reorder.
+    std::vector<double>& doubles = mReorderDoubles;
+    std::vector<float>& floats = mReorderFloats;
+    std::vector<std::uint32_t>& words = mReorderWords;
+
+    Gather(pool, mHandles, begin, order, mReorderHandles, grain);
+    for (std::size_t i = begin; i < begin + order.size(); ++i) {
+        mSlots[mHandles[i].index].dense = static_cast<std::uint32_t>(i);
+    }
+
+    Gather(pool, mMass, begin, order, doubles, grain);
+    Gather(pool, mPosition, begin, order, doubles, grain);
+    Gather(pool, mVelocity, begin, order, floats, grain);
+    Gather(pool, mAcceleration, begin, order, floats, grain);
+    Gather(pool, mAngle, begin, order, floats, grain);
+    Gather(pool, mAngularVelocity, begin, order, floats, grain);
+    Gather(pool, mAngularAcceleration, begin, order, floats, grain);
+    Gather(pool, mRadius, begin, order, floats, grain);
+    Gather(pool, mTags, begin, order, words, grain);
+    Gather(pool, mPreviousAcceleration, begin, order, floats, grain);
+    Gather(pool, mIdleTicks, begin, order, words, grain);
+    Gather(pool, mGroups, begin, order, words, grain);
+    if (HasLocalFrames()) {
+        Gather(pool, mLocalPosition, begin, order, floats, grain);
+        Gather(pool, mOrigin, begin, order, doubles, grain);
+    }
+    if (HasClosedFormMotion()) {
+        Gather(pool, mReferencePosition, begin, order, doubles, grain);
+        Gather(pool, mReferenceVelocity, begin, order, floats, grain);
+        Gather(pool, mReferenceAngle, begin, order, floats, grain);
+        Gather(pool, mReferenceAngularVelocity, begin, order, floats, grain);
+        Gather(pool, mReferenceTime, begin, order, doubles, grain);
+    }
+}
+
+std::size_t ParticleStore::IndexOf(ParticleHandle handle) const {
+    if (handle.index >= mSlots.size()) {
+        return NPOS;
+    }
+    const Slot& slot = mSlots[handle.index];
+    if (slot.dense == NO_ENTRY || slot.generation != handle.generation) {
+        return NPOS;
+    }
+    return slot.dense;
+}
+
+std::optional<ParticleRef> ParticleStore::Find(ParticleHandle handle) {
+    const std::size_t index = IndexOf(handle);
+    if (index == NPOS) {
+        return std::nullopt;
+    }
+    return ParticleRef(*this, index);
+}
+
+void ParticleStore::Clear() {
+    for (ParticleHandle handle : mHandles) {
+        mSlots[handle.index].dense = NO_ENTRY;
+        ++handle.generation;
+        mSlots[handle.index].generation = handle.generation;
+        mAllocator->Recycle(handle);
+    }
+    mHandles.clear();
+
+    mMass.clear();
+    physics::Clear(mPosition);
+    physics::Clear(mVelocity);
+    physics::Clear(mAcceleration);
+    physics::Clear(mAngle);
+    physics::Clear(mAngularVelocity);
+    physics::Clear(mAngularAcceleration);
+    mRadius.clear();
+    mTags.clear();
+    physics::Clear(mPreviousAcceleration);
+    mIdleTicks.clear();
+    mGroups.clear();
+    mPendingWakes.clear();
+    physics::Clear(mLocalPosition);
+    physics::Clear(mOrigin);
+    physics::Clear(mReferencePosition);
+    physics::Clear(mReferenceVelocity);
+    physics::Clear(mReferenceAngle);
+    physics::Clear(mReferenceAngularVelocity);
+    mReferenceTime.clear();
+    std::fill(mGroupStart.begin(), mGroupStart.end(), 0);
+}
+
+void ParticleStore::ResetIntegratorHistory() {
+    std::fill(mPreviousAcceleration.x.begin(), mPreviousAcceleration.x.end(),
+              kNoHistory);
+    std::fill(mPreviousAcceleration.y.begin(), mPreviousAcceleration.y.end(),
+              kNoHistory);
+    std::fill(mPreviousAcceleration.z.begin(), mPreviousAcceleration.z.end(),
+              kNoHistory);
+}
+
+void ParticleStore::EnableLocalFrames(double region_size) {
+    if (HasClosedFormMotion()) {
+        throw std::logic_error(
+            "Local frames and closed-form motion cannot be combined");
+    }
+    if (!(region_size > 0.0) || !std::isfinite(region_size)) {
+        throw std::invalid_argument(
+            "Local frame region size must be positive and finite");
+    }
+
+    // Frames already in use hold the exact positions.
+    if (HasLocalFrames()) {
+        SyncPositions(0, size());
+    }
+    mRegionSize = region_size;
+    RebuildLocalFrames();
+}
+
+std::size_t ParticleStore::Rebase(std::size_t begin, std::size_t end) {
+    // Recentre everything past half a region, not only the entries that
+    // passed a whole one, so the next call is a long way off.
+    const auto limit = static_cast<float>(0.5 * mRegionSize);
+    VectorColumns<float>& local = mLocalPosition;
+
+    std::size_t rebased = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+        const bool moved =
+            RebaseComponent(local.x[i], mOrigin.x[i], limit, mRegionSize) |
+            RebaseComponent(local.y[i], mOrigin.y[i], limit, mRegionSize) |
+            RebaseComponent(local.z[i], mOrigin.z[i], limit, mRegionSize);
+        rebased += moved ? 1 : 0;
+    }
+    return rebased;
+}
+
+void ParticleStore::EnableClosedFormMotion() {
+    if (HasLocalFrames()) {
+        throw std::logic_error(
+            "Local frames and closed-form motion cannot be combined");
+    }
+    if (mClosedForm) {
+        return;
+    }
+    mClosedForm = true;
+    RebuildReferences();
+}
+
+void ParticleStore::SyncPositions(std::size_t begin, std::size_t end) {
+    if (HasClosedFormMotion()) {
+        Extrapolate(mPosition, mVelocity, mReferencePosition,
+                    mReferenceVelocity, mAcceleration, mReferenceTime,
+                    mMotionTime, begin, end);
+        Extrapolate(mAngle, mAngularVelocity, mReferenceAngle,
+                    mReferenceAngularVelocity, mAngularAcceleration,
+                    mReferenceTime, mMotionTime, begin, end);
+        return;
+    }
+    AddOffsets(mPosition.x.data(), mOrigin.x.data(), mLocalPosition.x.data(),
+               begin, end);
+    AddOffsets(mPosition.y.data(), mOrigin.y.data(), mLocalPosition.y.data(),
+               begin, end);
+    AddOffsets(mPosition.z.data(), mOrigin.z.data(), mLocalPosition.z.data(),
+               begin, end);
+}
+
+math::WorldCoordinates ParticleStore::GetPosition(std::size_t index) const {
+    if (HasClosedFormMotion()) {
+        const double elapsed = mMotionTime - mReferenceTime[index];
+        return {ValueAt(mReferencePosition.x[index],
+                        mReferenceVelocity.x[index], mAcceleration.x[index],
+                        elapsed),
+                ValueAt(mReferencePosition.y[index],
+                        mReferenceVelocity.y[index], mAcceleration.y[index],
+                        elapsed),
+                ValueAt(mReferencePosition.z[index],
+                        mReferenceVelocity.z[index], mAcceleration.z[index],
+                        elapsed)};
+    }
+    if (HasLocalFrames()) {
+        const VectorColumns<float>& local = mLocalPosition;
+        return {mOrigin.x[index] + static_cast<double>(local.x[index]),
+                mOrigin.y[index] + static_cast<double>(local.y[index]),
+                mOrigin.z[index] + static_cast<double>(local.z[index])};
+    }
+    return {mPosition.x[index], mPosition.y[index], mPosition.z[index]};
+}
+
+math::Vector ParticleStore::GetVelocity(std::size_t index) const {
+    if (HasClosedFormMotion()) {
+        return RateAt(mReferenceVelocity, mAcceleration, index,
+                      mMotionTime - mReferenceTime[index]);
+    }
+    return Read(mVelocity, index);
+}
+
+math::Vector ParticleStore::GetAngle(std::size_t index) const {
+    if (HasClosedFormMotion()) {
+        return ValueAt(mReferenceAngle, mReferenceAngularVelocity,
+                       mAngularAcceleration, index,
+                       mMotionTime - mReferenceTime[index]);
+    }
+    return Read(mAngle, index);
+}
+
+math::Vector ParticleStore::GetAngularVelocity(std::size_t index) const {
+    if (HasClosedFormMotion()) {
+        return RateAt(mReferenceAngularVelocity, mAngularAcceleration, index,
+                      mMotionTime - mReferenceTime[index]);
+    }
+    return Read(mAngularVelocity, index);
+}
+
+void ParticleStore::SetPosition(std::size_t index,
+                                const math::WorldCoordinates& position) {
+    if (HasClosedFormMotion()) {
+        Rereference(index);
+        Write(mReferencePosition, index, position);
+    }
+    MarkMoved(index);
+    Write(mPosition, index, position);
+    if (HasLocalFrames()) {
+        PlaceInRegion(index, position);
+    }
+}
+
+void ParticleStore::SetVelocity(std::size_t index,
+                                const math::Vector& velocity) {
+    if (HasClosedFormMotion()) {
+        Rereference(index);
+        Write(mReferenceVelocity, index, velocity);
+    }
+    MarkMoved(index);
+    Write(mVelocity, index, velocity);
+}
+
+void ParticleStore::SetAcceleration(std::size_t index,
+                                    const math::Vector& acceleration) {
+    // The old acceleration holds up to now, the new one from here on.
+    if (HasClosedFormMotion()) {
+        Rereference(index);
+    }
+    MarkMoved(index);
+    Write(mAcceleration, index, acceleration);
+}
+
+void ParticleStore::SetAngle(std::size_t index, const math::Vector& angle) {
+    if (HasClosedFormMotion()) {
+        Rereference(index);
+        Write(mReferenceAngle, index, angle);
+    }
+    MarkMoved(index);
+    Write(mAngle, index, angle);
+}
+
+void ParticleStore::SetAngularVelocity(std::size_t index,
+                                       const math::Vector& angular_velocity) {
+    if (HasClosedFormMotion()) {
+        Rereference(index);
+        Write(mReferenceAngularVelocity, index, angular_velocity);
+    }
+    MarkMoved(index);
+    Write(mAngularVelocity, index, angular_velocity);
+}
+
+void ParticleStore::SetAngularAcceleration(
+    std::size_t index, const math::Vector& angular_acceleration) {
+    if (HasClosedFormMotion()) {
+        Rereference(index);
+    }
+    MarkMoved(index);
+    Write(mAngularAcceleration, index, angular_acceleration);
+}
+
+void ParticleStore::PlaceInRegion(std::size_t index,
+                                  const math::WorldCoordinates& position) {
+    const double origin_x = RegionOrigin(position.GetX(), mRegionSize);
+    const double origin_y = RegionOrigin(position.GetY(), mRegionSize);
+    const double origin_z = RegionOrigin(position.GetZ(), mRegionSize);
+    mOrigin.x[index] = origin_x;
+    mOrigin.y[index] = origin_y;
+    mOrigin.z[index] = origin_z;
+    mLocalPosition.x[index] = static_cast<float>(position.GetX() - origin_x);
+    mLocalPosition.y[index] = static_cast<float>(position.GetY() - origin_y);
+    mLocalPosition.z[index] = static_cast<float>(position.GetZ() - origin_z);
+}
+
+void ParticleStore::RebuildLocalFrames() {
+    Resize(mLocalPosition, size());
+    Resize(mOrigin, size());
+    for (std::size_t i = 0; i < size(); ++i) {
+        PlaceInRegion(i, math::WorldCoordinates(
+                             mPosition.x[i], mPosition.y[i], mPosition.z[i]));
+    }
+}
+
+void ParticleStore::RebuildReferences() {
+    mReferencePosition = mPosition;
+    mReferenceVelocity = mVelocity;
+    mReferenceAngle = mAngle;
+    mReferenceAngularVelocity = mAngularVelocity;
+    mReferenceTime.assign(size(), mMotionTime);
+}
+
+void ParticleStore::Rereference(std::size_t index) {
+    Write(mReferencePosition, index, GetPosition(index));
+    Write(mReferenceVelocity, index, GetVelocity(index));
+    Write(mReferenceAngle, index, GetAngle(index));
+    Write(mReferenceAngularVelocity, index, GetAngularVelocity(index));
+    mReferenceTime[index] = mMotionTime;
+}
+
+void ParticleStore::MoveEntry(std::size_t from, std::size_t to) {
+    mSlots[mHandles[from].index].dense = static_cast<std::uint32_t>(to);
+    CopyEntry(mHandles, from, to);
+
+    CopyEntry(mMass, from, to);
+    CopyEntry(mPosition, from, to);
+    CopyEntry(mVelocity, from, to);
+    CopyEntry(mAcceleration, from, to);
+    CopyEntry(mAngle, from, to);
+    CopyEntry(mAngularVelocity, from, to);
+    CopyEntry(mAngularAcceleration, from, to);
+    CopyEntry(mRadius, from, to);
+    CopyEntry(mTags, from, to);
+    CopyEntry(mPreviousAcceleration, from, to);
+    CopyEntry(mIdleTicks, from, to);
+    CopyEntry(mGroups, from, to);
+    if (HasLocalFrames()) {
+        CopyEntry(mLocalPosition, from, to);
+        CopyEntry(mOrigin, from, to);
+    }
+    if (HasClosedFormMotion()) {
+        CopyEntry(mReferencePosition, from, to);
+        CopyEntry(mReferenceVelocity, from, to);
+        CopyEntry(mReferenceAngle, from, to);
+        CopyEntry(mReferenceAngularVelocity, from, to);
+        CopyEntry(mReferenceTime, from, to);
+    }
+}
+
+std::uint32_t ParticleStore::GetSlotGeneration(std::uint32_t slot) const {
+    // Reserved slots that were never inserted are still on generation 0.
+    return slot < mSlots.size() ? mSlots[slot].generation : 0;
+}
+
+void ParticleStore::RestoreSlots(
+    std::vector<ParticleHandle> handles,
+    const std::vector<std::uint32_t>& generations) {
+    std::vector<Slot> slots(generations.size());
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+        slots[i].generation = generations[i];
+    }
+
+    for (std::size_t dense = 0; dense < handles.size(); ++dense) {
+        const ParticleHandle handle = handles[dense];
+        if (handle.index >= slots.size() ||
+            slots[handle.index].dense != NO_ENTRY ||
+            slots[handle.index].generation != handle.generation) {
+            throw std::invalid_argument(
+                "Particle handle at index: " + std::to_string(dense) +
+                " does not match the slot map");
+        }
+        slots[handle.index].dense = static_cast<std::uint32_t>(dense);
+    }
+
+    auto allocator = std::make_unique<HandleAllocator>(
+        HandleAllocator::DEFAULT_RECYCLE_CAPACITY,
+        static_cast<std::uint32_t>(slots.size()));
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+        if (slots[i].dense == NO_ENTRY) {
+            allocator->Recycle({static_cast<std::uint32_t>(i),
+                                slots[i].generation});
+        }
+    }
+
+    mAllocator = std::move(allocator);
+    mSlots = std::move(slots);
+    mHandles = std::move(handles);
+
+    // Everything starts awake in the first group until RestoreGroups().
+    mIdleTicks.assign(mHandles.size(), 0);
+    mGroups.assign(mHandles.size(), 0);
+    mPendingWakes.clear();
+    std::fill(mGroupStart.begin() + 1, mGroupStart.end(), mHandles.size());
+
+    if (HasLocalFrames()) {
+        RebuildLocalFrames();
+    }
+    if (HasClosedFormMotion()) {
+        RebuildReferences();
+    }
+}
+
+void ParticleStore::RestoreGroups(std::vector<std::uint32_t> groups,
+                                  std::vector<std::uint32_t> idle_ticks,
+                                  std::vector<std::size_t> group_start,
+                                  std::vector<ParticleHandle> pending_wakes) {
+    if (groups.size() != size() || idle_ticks.size() != size()) {
+        throw std::invalid_argument(
+            "Group and idle tick columns must hold every entry");
+    }
+    if (group_start.size() < 2 || group_start.front() != 0 ||
+        !std::is_sorted(group_start.begin(), group_start.end()) ||
+        group_start.back() > size()) {
+        throw std::invalid_argument("Group ranges are out of order");
+    }
+
+    const std::size_t group_count = group_start.size() - 1;
+    const std::size_t awake = group_start.back();
+    for (std::size_t index = 0; index < size(); ++index) {
+        const std::uint32_t group = groups[index];
+        if (group >= group_count ||
+            (index < awake && (index < group_start[group] ||
+                               index >= group_start[group + 1]))) {
+            throw std::invalid_argument(
+                "Particle at index: " + std::to_string(index) +
+                " lies outside its group");
+        }
+    }
+
+    mGroups = std::move(groups);
+    mIdleTicks = std::move(idle_ticks);
+    mGroupStart = std::move(group_start);
+    mPendingWakes = std::move(pending_wakes);
+}
+
+Particle ParticleStore::Get(std::size_t index) const {
+    Particle particle(mMass[index]);
+    particle.SetPosition(GetPosition(index));
+    particle.SetVelocity(GetVelocity(index));
+    particle.SetAcceleration(Read(mAcceleration, index));
+    particle.SetAngle(GetAngle(index));
+    particle.SetAngularVelocity(GetAngularVelocity(index));
+    particle.SetAngularAcceleration(Read(mAngularAcceleration, index));
+    particle.SetRadius(mRadius[index]);
+    particle.SetTags(mTags[index]);
+    return particle;
+}
+
+ParticleRef ParticleStore::at(std::size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("Particle index: " + std::to_string(index) +
+                                " is out of range");
+    }
+    return {*this, index};
+}
+
+}  // namespace physics
+}  // namespace solo
@@ -0,0 +1,413 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Physics/BarnesHut.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "Particle/ParticleStore.h"
+#include "Physics/Morton.h"
+#include "Physics/RadixSort.h"
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace physics {
+
+namespace {
+
+// Bodies per pool chunk for the linear passes of the build
+constexpr std::size_t kBuildChunkSize = 16384;
+
+// Leaves per pool chunk for force evaluation, which costs far more per body
+// than the build
+constexpr std::size_t kEvaluateChunkSize = 32;
+
+// Cells holding this many bodies or fewer are summed directly
+constexpr std::size_t kLeafSize = 16;
+
+// Depth at which the serial build hands subtrees to the pool; up to 8^3
+// subtrees gives enough tasks to balance across the pool.
+constexpr std::uint32_t kTaskLevel = 3;
+
+// Deepest level resolvable by the Morton code
+constexpr std::uint32_t kMaxLevel = MORTON_BITS;
+
+// Deepest possible traversal stack: seven siblings left per level
+constexpr std::size_t kStackSize = 8 * (kMaxLevel + 1);
+
+}  // namespace
+
+BarnesHut::BarnesHut(const BarnesHutSettings& settings,
+                     std::pmr::memory_resource* resource)
+    : mSettings(settings), mResource(resource) {}
+
+void BarnesHut::Accumulate(const ParticleStore& store,
+                           VectorColumns<float>& acceleration,
+                           threading::ThreadPool* pool) {
+    mNodes.clear();
+    if (store.size() < 2) {
+        return;
+    }
+
+    SortBodies(store, pool);
+    BuildTree(pool);
+
+    threading::ParallelFor(pool, mLeaves.size(), kEvaluateChunkSize,
+                           [this, &acceleration](std::size_t begin,
+                                                 std::size_t end) {
+                               Evaluate(begin, end, acceleration);
+                           });
+}
+
+void BarnesHut::SortBodies(const ParticleStore& store,
+                           threading::ThreadPool* pool) {
+    const std::size_t count = store.size();
+    const VectorColumns<double>& position = store.Position();
+    const std::vector<double>& mass = store.Mass();
+
+    std::pmr::vector<PositionBounds> chunk_bounds(mResource);
+    const MortonCube cube =
+        ComputeMortonCube(store, chunk_bounds, pool, kBuildChunkSize);
+    mOriginX = cube.origin_x;
+    mOriginY = cube.origin_y;
+    mOriginZ = cube.origin_z;
+    mExtent = cube.extent;
+    const double scale = cube.Scale(MORTON_BITS);
+
+    mOrder.resize(count);
+    threading::ParallelFor(
+        pool, count, kBuildChunkSize, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                mOrder[i].code = EncodeMorton(position.x[i] - mOriginX,
+                                              position.y[i] - mOriginY,
+                                              position.z[i] - mOriginZ, scale);
+                mOrder[i].index = static_cast<std::uint32_t>(i);
+            }
+        });
+
+    RadixSort(
+        mOrder, mSortScratch, [](const SortEntry& entry) { return entry.code; },
+        3 * MORTON_BITS);
+
+    mBodies.resize(count);
+    threading::ParallelFor(
+        pool, count, kBuildChunkSize, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t k = begin; k < end; ++k) {
+                const std::uint32_t i = mOrder[k].index;
+                mBodies[k] = {position.x[i], position.y[i], position.z[i],
+                              mass[i]};
+            }
+        });
+}
+
+void BarnesHut::BuildTree(threading::ThreadPool* pool) {
+    Node root;
+    root.corner_x = mOriginX;
+    root.corner_y = mOriginY;
+    root.corner_z = mOriginZ;
+    root.size = mExtent;
+    root.end = static_cast<std::uint32_t>(mBodies.size());
+    mNodes.push_back(root);
+
+    // Top levels on this thread; deeper subtrees are left as tasks.
+    std::pmr::vector<Task> tasks(mResource);
+    Subdivide(mNodes, 0, 0, &tasks);
+    const std::size_t top_count = mNodes.size();
+
+    // Each task builds its subtree into its own node list, rooted at a
+    // copy of the task node.
+    mSubtrees.resize(tasks.size());
+    threading::ParallelFor(pool, tasks.size(), 1,
+                           [&](std::size_t begin, std::size_t end) {
+                               for (std::size_t t = begin; t < end; ++t) {
+                                   std::vector<Node>& subtree = mSubtrees[t];
+                                   subtree.assign(1, mNodes[tasks[t].node]);
+                                   Subdivide(subtree, 0, tasks[t].level,
+                                             nullptr);
+                               }
+                           });
+
+    // Splice the subtrees after the top levels. Local index k > 0 of
+    // subtree t lands at bases[t] + k - 1.
+    std::pmr::vector<std::size_t> bases(tasks.size(), mResource);
+    std::size_t total = top_count;
+    for (std::size_t t = 0; t < tasks.size(); ++t) {
+        bases[t] = total;
+        total += mSubtrees[t].size() - 1;
+    }
+    mNodes.resize(total);
+    threading::ParallelFor(
+        pool, tasks.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t t = begin; t < end; ++t) {
+                const std::vector<Node>& subtree = mSubtrees[t];
+                const auto offset = static_cast<std::uint32_t>(bases[t] - 1);
+                for (std::size_t k = 0; k < subtree.size(); ++k) {
+                    Node node = subtree[k];
+                    if (node.child_count > 0) {
+                        node.first_child += offset;
+                    }
+                    mNodes[k == 0 ? tasks[t].node : bases[t] + k - 1] = node;
+                }
+            }
+        });
+
+    // The top levels were summarised before their tasks finished; redo
+    // them bottom up now every child is final. Children always follow
+    // their parent, so reverse order visits children first.
+    for (std::size_t i = top_count; i-- > 0;) {
+        if (mNodes[i].child_count > 0) {
+            Summarize(mNodes[i], mNodes);
+        }
+    }
+
+    mLeaves.clear();
+    for (std::size_t i = 0; i < mNodes.size(); ++i) {
+        if (mNodes[i].child_count == 0) {
+            mLeaves.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+}
+
+void BarnesHut::Subdivide(std::vector<Node>& nodes, std::uint32_t node,
+                          std::uint32_t level,
+                          std::pmr::vector<Task>* tasks) const {
+    const std::uint32_t begin = nodes[node].begin;
+    const std::uint32_t end = nodes[node].end;
+
+    if (end - begin <= kLeafSize || level == kMaxLevel) {
+        Summarize(nodes[node], nodes);
+        return;
+    }
+    if (tasks != nullptr && level == kTaskLevel) {
+        tasks->push_back({node, level});
+        return;
+    }
+
+    // Bodies are sorted by code, so each octant is a contiguous run found
+    // by searching on the octant digit of this level.
+    const std::uint32_t shift = 3 * (kMaxLevel - 1 - level);
+    const auto digit = [this, shift](std::uint32_t body) {
+        return static_cast<std::uint32_t>(mOrder[body].code >> shift) & 7u;
+    };
+
+    const Node parent = nodes[node];
+    const double half = parent.size * 0.5;
+    const auto first_child = static_cast<std::uint32_t>(nodes.size());
+    std::uint32_t child_count = 0;
+
+    std::uint32_t start = begin;
+    while (start < end) {
+        const std::uint32_t octant = digit(start);
+        std::uint32_t low = start;
+        std::uint32_t high = end;
+        while (low < high) {
+            const std::uint32_t middle = low + (high - low) / 2;
+            if (digit(middle) == octant) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+
+        Node child;
+        child.corner_x = parent.corner_x + ((octant >> 2) & 1u) * half;
+        child.corner_y = parent.corner_y + ((octant >> 1) & 1u) * half;
+        child.corner_z = parent.corner_z + (octant & 1u) * half;
+        child.size = half;
+        child.begin = start;
+        child.end = low;
+        nodes.push_back(child);
+        ++child_count;
+        start = low;
+    }
+
+    nodes[node].first_child = first_child;
+    nodes[node].child_count = child_count;
+    for (std::uint32_t c = 0; c < child_count; ++c) {
+        Subdivide(nodes, first_child + c, level + 1, tasks);
+    }
+    Summarize(nodes[node], nodes);
+}
+
+void BarnesHut::Summarize(Node& node, const std::vector<Node>& nodes) const {
+    double mass = 0.0;
+    double x = 0.0;
+    double y = 0.0;
+    double z = 0.0;
+
+    if (node.child_count == 0) {
+        for (std::uint32_t k = node.begin; k < node.end; ++k) {
+            const Body& body = mBodies[k];
+            mass += body.mass;
+            x += body.mass * body.x;
+            y += body.mass * body.y;
+            z += body.mass * body.z;
+        }
+    } else {
+        for (std::uint32_t c = 0; c < node.child_count; ++c) {
+            const Node& child = nodes[node.first_child + c];
+            mass += child.mass;
+            x += child.mass * child.center_x;
+            y += child.mass * child.center_y;
+            z += child.mass * child.center_z;
+        }
+    }
+
+    node.mass = mass;
+    if (mass > 0.0) {
+        node.center_x = x / mass;
+        node.center_y = y / mass;
+        node.center_z = z / mass;
+    } else {
+        // Massless cells attract nothing; keep the centre finite.
+        node.center_x = node.corner_x + node.size * 0.5;
+        node.center_y = node.corner_y + node.size * 0.5;
+        node.center_z = node.corner_z + node.size * 0.5;
+    }
+}
+
+void BarnesHut::Evaluate(std::size_t begin, std::size_t end,
+                         VectorColumns<float>& acceleration) const {
+    const double theta_squared =
+        mSettings.opening_angle * mSettings.opening_angle;
+    const double softening_squared = mSettings.softening * mSettings.softening;
+    const double g = mSettings.gravitational_constant;
+
+    // Sources acting on the current group: accepted cells and the bodies of
+    // opened leaves, flattened so the per-body loop is a plain sweep.
+    std::pmr::vector<double> source_x(mResource);
+    std::pmr::vector<double> source_y(mResource);
+    std::pmr::vector<double> source_z(mResource);
+    std::pmr::vector<double> source_mass(mResource);
+    std::array<std::uint32_t, kStackSize> stack;
+
+    const auto add_source = [&](double x, double y, double z, double mass) {
+        source_x.push_back(x);
+        source_y.push_back(y);
+        source_z.push_back(z);
+        source_mass.push_back(mass);
+    };
+
+    for (std::size_t leaf = begin; leaf < end; ++leaf) {
+        const Node& group = mNodes[mLeaves[leaf]];
+
+        // Tight bounds of the group's bodies
+        PositionBounds bounds;
+        for (std::uint32_t k = group.begin; k < group.end; ++k) {
+            bounds.Extend(mBodies[k].x, mBodies[k].y, mBodies[k].z);
+        }
+
+        // One walk per group. A cell is accepted only when it is far
+        // enough from the nearest point of the group, so every body of
+        // the group would have accepted it on its own. Cells holding the
+        // group are always opened: past an angle of 1/sqrt(3) their centre
+        // of mass can pass the test, which would count the group twice.
+        source_x.clear();
+        source_y.clear();
+        source_z.clear();
+        source_mass.clear();
+        std::size_t depth = 0;
+        stack[depth++] = 0;
+        while (depth > 0) {
+            const std::uint32_t index = stack[--depth];
+            const Node& node = mNodes[index];
+            if (index == mLeaves[leaf]) {
+                continue;
+            }
+
+            const double gap_x = std::max({bounds.min_x - node.center_x, 0.0,
+                                           node.center_x - bounds.max_x});
+            const double gap_y = std::max({bounds.min_y - node.center_y, 0.0,
+                                           node.center_y - bounds.max_y});
+            const double gap_z = std::max({bounds.min_z - node.center_z, 0.0,
+                                           node.center_z - bounds.max_z});
+            const double gap_squared =
+                gap_x * gap_x + gap_y * gap_y + gap_z * gap_z;
+            const bool holds_group =
+                node.begin <= group.begin && group.end <= node.end;
+            if (!holds_group &&
+                node.size * node.size < theta_squared * gap_squared) {
+                add_source(node.center_x, node.center_y, node.center_z,
+                           node.mass);
+                continue;
+            }
+
+            if (node.child_count == 0) {
+                for (std::uint32_t j = node.begin; j < node.end; ++j) {
+                    add_source(mBodies[j].x, mBodies[j].y, mBodies[j].z,
+                               mBodies[j].mass);
+                }
+                continue;
+            }
+            for (std::uint32_t c = 0; c < node.child_count; ++c) {
+                stack[depth++] = node.first_child + c;
+            }
+        }
+
+        const std::size_t source_count = source_mass.size();
+        const double* __restrict sx = source_x.data();
+        const double* __restrict sy = source_y.data();
+        const double* __restrict sz = source_z.data();
+        const double* __restrict sm = source_mass.data();
+
+        for (std::uint32_t k = group.begin; k < group.end; ++k) {
+            const Body& body = mBodies[k];
+            double ax = 0.0;
+            double ay = 0.0;
+            double az = 0.0;
+
+            for (std::size_t s = 0; s < source_count; ++s) {
+                const double dx = sx[s] - body.x;
+                const double dy = sy[s] - body.y;
+                const double dz = sz[s] - body.z;
+                const double distance_squared =
+                    dx * dx + dy * dy + dz * dz + softening_squared;
+                const double inverse = 1.0 / std::sqrt(distance_squared);
+                const double strength = sm[s] * inverse * inverse * inverse;
+                ax += strength * dx;
+                ay += strength * dy;
+                az += strength * dz;
+            }
+
+            // Bodies of the group itself, skipping self interaction
+            for (std::uint32_t j = group.begin; j < group.end; ++j) {
+                if (j == k) {
+                    continue;
+                }
+                const double dx = mBodies[j].x - body.x;
+                const double dy = mBodies[j].y - body.y;
+                const double dz = mBodies[j].z - body.z;
+                const double distance_squared =
+                    dx * dx + dy * dy + dz * dz + softening_squared;
+                const double inverse = 1.0 / std::sqrt(distance_squared);
+                const double strength =
+                    mBodies[j].mass * inverse * inverse * inverse;
+                ax += strength * dx;
+                ay += strength * dy;
+                az += strength * dz;
+            }
+
+            const std::uint32_t index = mOrder[k].index;
+            acceleration.x[index] += static_cast<float>(g * ax);
+            acceleration.y[index] += static_cast<float>(g * ay);
+            acceleration.z[index] += static_cast<float>(g * az);
+        }
+    }
+}
+
+}  // namespace physics
+}  // namespace solo
@@ -0,0 +1,120 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Physics/BroadPhase.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Particle/ParticleStore.h"
+#include "Physics/SpatialGrid.h"
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace physics {
+
+namespace {
+
+// Particles tested per chunk. Also the unit of the per-chunk pair buffers,
+// so it is fixed rather than derived from the thread count.
+constexpr std::size_t kPairChunkSize = 4096;
+
+}  // namespace
+
+void BroadPhase::Update(const ParticleStore& store,
+                        threading::ThreadPool* pool) {
+    mPairs.clear();
+
+    const std::vector<float>& radius = store.Radius();
+    mRadii.clear();
+    std::copy_if(radius.begin(), radius.end(), std::back_inserter(mRadii),
+                 [](float value) { return value > 0.0f; });
+    if (mRadii.empty()) {
+        return;
+    }
+
+    // Cells fit a typical particle. The larger particles query further,
+    // and the grid bounds their cost by a linear scan.
+    const auto median = mRadii.begin() + mRadii.size() / 2;
+    std::nth_element(mRadii.begin(), median, mRadii.end());
+    mGrid.SetCellSize(2.0 * static_cast<double>(*median));
+    mGrid.Build(store, pool);
+
+    const std::size_t count = store.size();
+    const std::size_t chunk_count =
+        (count + kPairChunkSize - 1) / kPairChunkSize;
+    mChunkPairs.resize(chunk_count);
+
+    const VectorColumns<double>& position = store.Position();
+    const std::vector<ParticleHandle>& handles = store.Handles();
+
+    const auto test_range = [&](std::size_t begin, std::size_t end) {
+        std::vector<CollisionPair>& pairs = mChunkPairs[begin / kPairChunkSize];
+        pairs.clear();
+
+        for (std::size_t i = begin; i < end; ++i) {
+            const float own_radius = radius[i];
+            if (own_radius <= 0.0f) {
+                continue;
+            }
+
+            // Every particle this one owns a pair with is no larger, so
+            // overlaps lie within twice its radius.
+            const math::WorldCoordinates center(
+                position.x[i], position.y[i], position.z[i]);
+            mGrid.ForEachInRadius(
+                center, 2.0 * static_cast<double>(own_radius),
+                [&](std::size_t j, double distance_squared) {
+                    const float other_radius = radius[j];
+                    if (other_radius <= 0.0f || other_radius > own_radius ||
+                        (other_radius == own_radius && j <= i)) {
+                        return;
+                    }
+                    const double reach = static_cast<double>(own_radius) +
+                                         static_cast<double>(other_radius);
+                    if (distance_squared <= reach * reach) {
+                        const std::size_t first = std::min(i, j);
+                        const std::size_t second = std::max(i, j);
+                        pairs.push_back({static_cast<std::uint32_t>(first),
+                                         static_cast<std::uint32_t>(second),
+                                         handles[first], handles[second]});
+                    }
+                });
+        }
+    };
+
+    threading::ParallelFor(pool, count, kPairChunkSize, test_range);
+
+    std::size_t total = 0;
+    for (const std::vector<CollisionPair>& pairs : mChunkPairs) {
+        total += pairs.size();
+    }
+    mPairs.reserve(total);
+    for (const std::vector<CollisionPair>& pairs : mChunkPairs) {
+        mPairs.insert(mPairs.end(), pairs.begin(), pairs.end());
+    }
+
+    // A pair sits in its owner's chunk, which need not hold its first
+    // index, and the grid visits candidates in cell order.
+    std::sort(mPairs.begin(), mPairs.end(),
+              [](const CollisionPair& left, const CollisionPair& right) {
+                  return left.first_index != right.first_index
+                             ? left.first_index < right.first_index
+                             : left.second_index < right.second_index;
+              });
+}
+
+}  // namespace physics
+}  // namespace solo
@@ -0,0 +1,242 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Physics/EmitterRegistry.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Math/Vector.h"
+#include "Particle/Particle.h"
+#include "Particle/ParticleHandle.h"
+#include "Particle/ParticleStore.h"
+
+namespace solo {
+namespace physics {
+
+namespace {
+
+/// @brief Next value of a splitmix64 stream. Cheap enough to draw several
+/// numbers per particle of a large burst.
+std::uint64_t NextRandom(std::uint64_t& state) {
+    state += 0x9E3779B97F4A7C15ULL;
+    std::uint64_t value = state;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+/// @brief Uniform value in [-1, 1)
+double UniformSigned(std::uint64_t& state) {
+    return static_cast<double>(NextRandom(state) >> 11) * 0x1.0p-52 - 1.0;
+}
+
+/// @brief Uniform point of the box mean +- spread
+math::WorldCoordinates Jitter(const math::WorldCoordinates& mean,
+                              const math::Vector& spread,
+                              std::uint64_t& state) {
+    const double x = mean.GetX() + spread.GetX() * UniformSigned(state);
+    const double y = mean.GetY() + spread.GetY() * UniformSigned(state);
+    const double z = mean.GetZ() + spread.GetZ() * UniformSigned(state);
+    return {x, y, z};
+}
+
+math::Vector Jitter(const math::Vector& mean, const math::Vector& spread,
+                    std::uint64_t& state) {
+    const auto component = [&state](float value, float half_width) {
+        return static_cast<float>(value + half_width * UniformSigned(state));
+    };
+    const float x = component(mean.GetX(), spread.GetX());
+    const float y = component(mean.GetY(), spread.GetY());
+    const float z = component(mean.GetZ(), spread.GetZ());
+    return {x, y, z};
+}
+
+}  // namespace
+
+EmitterId EmitterRegistry::Add(const Emitter& emitter, ParticleStore& store) {
+    if (!(emitter.rate >= 0.0) || !std::isfinite(emitter.rate) ||
+        !(emitter.lifetime_spread >= 0.0) ||
+        !(emitter.lifetime_spread < emitter.lifetime)) {
+        throw std::invalid_argument(
+            "Emitter rate and lifetime spread must be at least zero, and "
+            "the spread below the lifetime");
+    }
+
+    // Size everything a burst touches now, so spawning never allocates.
+    mCapacity += emitter.capacity;
+    store.Reserve(store.size() + mCapacity);
+    mExpiries.reserve(mCapacity);
+    mExpired.reserve(mCapacity);
+
+    Entry entry;
+    entry.emitter = emitter;
+    entry.id = mNextId;
+    entry.random = emitter.seed;
+    mEntries.push_back(entry);
+    return mNextId++;
+}
+
+bool EmitterRegistry::Remove(EmitterId id) {
+    const auto found =
+        std::find_if(mEntries.begin(), mEntries.end(),
+                     [id](const Entry& entry) { return entry.id == id; });
+    if (found == mEntries.end()) {
+        return false;
+    }
+    mEntries.erase(found);
+    return true;
+}
+
+const Emitter* EmitterRegistry::Find(EmitterId id) const {
+    const Entry* entry = FindEntry(id);
+    return entry != nullptr ? &entry->emitter : nullptr;
+}
+
+bool EmitterRegistry::Burst(EmitterId id, std::size_t count) {
+    Entry* entry = FindEntry(id);
+    if (entry == nullptr) {
+        return false;
+    }
+    entry->pending += count;
+    return true;
+}
+
+const std::vector<ParticleHandle>& EmitterRegistry::Expire() {
+    mExpired.clear();
+    if (mTime < mNextExpiry) {
+        return mExpired;
+    }
+
+    // One pass collects every ended lifetime and packs the rest, finding
+    // the next expiry on the way.
+    double next_expiry = std::numeric_limits<double>::infinity();
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < mExpiries.size(); ++i) {
+        const Expiry expiry = mExpiries[i];
+        if (expiry.time > mTime) {
+            next_expiry = std::min(next_expiry, expiry.time);
+            mExpiries[kept++] = expiry;
+            continue;
+        }
+        mExpired.push_back(expiry.handle);
+        // The emitter may have been removed since.
+        if (Entry* entry = FindEntry(expiry.emitter)) {
+            --entry->live;
+        }
+    }
+    mExpiries.resize(kept);
+    mNextExpiry = next_expiry;
+    return mExpired;
+}
+
+std::size_t EmitterRegistry::Spawn(ParticleStore& store, double time_step) {
+    std::size_t spawned = 0;
+    for (Entry& entry : mEntries) {
+        entry.carry += entry.emitter.rate * time_step;
+        const auto from_rate = static_cast<std::size_t>(entry.carry);
+        entry.carry -= static_cast<double>(from_rate);
+
+        const std::size_t due = from_rate + entry.pending;
+        // A restored emitter may hold more than a smaller capacity allows.
+        const std::size_t room =
+            entry.emitter.capacity - std::min(entry.live,
+                                              entry.emitter.capacity);
+        const std::size_t count = std::min(due, room);
+        entry.pending = 0;
+        mDropped += due - count;
+        if (count > 0) {
+            SpawnBatch(entry, store, count);
+            spawned += count;
+        }
+    }
+    mTime += time_step;
+    return spawned;
+}
+
+void EmitterRegistry::SpawnBatch(Entry& entry, ParticleStore& store,
+                                 std::size_t count) {
+    const Emitter& emitter = entry.emitter;
+    Particle prototype(emitter.mass);
+    prototype.SetPosition(emitter.position);
+    prototype.SetVelocity(emitter.velocity);
+    prototype.SetAcceleration(emitter.acceleration);
+    prototype.SetRadius(emitter.radius);
+    prototype.SetTags(emitter.tags);
+
+    // Copies go in with one fill per column; only the drawn state is
+    // written per particle.
+    const auto [first, last] = store.AddCopies(prototype, count);
+    for (std::size_t i = first; i < last; ++i) {
+        store.SetPosition(
+            i, Jitter(emitter.position, emitter.position_spread,
+                      entry.random));
+        store.SetVelocity(
+            i, Jitter(emitter.velocity, emitter.velocity_spread,
+                      entry.random));
+
+        Expiry expiry;
+        expiry.time = mTime + emitter.lifetime +
+                      emitter.lifetime_spread * UniformSigned(entry.random);
+        expiry.handle = store.GetHandle(i);
+        expiry.emitter = entry.id;
+        mNextExpiry = std::min(mNextExpiry, expiry.time);
+        mExpiries.push_back(expiry);
+    }
+    entry.live += count;
+}
+
+void EmitterRegistry::RestoreLifetimes(const std::vector<Expiry>& expiries,
+                                       double time) {
+    // Copied into the reserved buffer, so later bursts still do not
+    // allocate.
+    mExpiries.assign(expiries.begin(), expiries.end());
+    mTime = time;
+    mNextExpiry = std::numeric_limits<double>::infinity();
+    for (Entry& entry : mEntries) {
+        entry.live = 0;
+    }
+    for (const Expiry& expiry : mExpiries) {
+        mNextExpiry = std::min(mNextExpiry, expiry.time);
+        if (Entry* entry = FindEntry(expiry.emitter)) {
+            ++entry->live;
+        }
+    }
+}
+
+std::size_t EmitterRegistry::GetLiveCount(EmitterId id) const {
+    const Entry* entry = FindEntry(id);
+    return entry != nullptr ? entry->live : 0;
+}
+
+EmitterRegistry::Entry* EmitterRegistry::FindEntry(EmitterId id) {
+    const auto found =
+        std::find_if(mEntries.begin(), mEntries.end(),
+                     [id](const Entry& entry) { return entry.id == id; });
+    return found != mEntries.end() ? &*found : nullptr;
+}
+
+const EmitterRegistry::Entry* EmitterRegistry::FindEntry(
+    EmitterId id) const {
+    const auto found =
+        std::find_if(mEntries.begin(), mEntries.end(),
+                     [id](const Entry& entry) { return entry.id == id; });
+    return found != mEntries.end() ? &*found : nullptr;
+}
+
+}  // namespace physics
+}  // namespace solo
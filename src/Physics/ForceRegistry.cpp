@@ -0,0 +1,241 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Physics/ForceRegistry.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "Math/Vector.h"
+#include "Particle/ParticleStore.h"
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace physics {
+
+namespace {
+
+// Particles per pool task.
+constexpr std::size_t kForceChunkSize = 8192;
+
+// Particles every generator visits before the sweep moves on. The block's
+// velocity, mass, tags and output stay resident in L1 between generators.
+constexpr std::size_t kForceBlockSize = 256;
+
+/// @brief Pointers to one block of the columns a generator reads and writes
+struct Block {
+    std::size_t count;
+    const float* vx;
+    const float* vy;
+    const float* vz;
+    const std::uint32_t* tags;
+    const float* inverse_mass;
+    float* ax;
+    float* ay;
+    float* az;
+};
+
+/// @brief 1 when the generator's mask selects the tags, otherwise 0.
+/// Used as a multiplier so the loops stay free of branches.
+float Selects(std::uint32_t mask, std::uint32_t tags) {
+    return static_cast<float>((tags & mask) != 0);
+}
+
+void ApplyUniform(const ForceGenerator& generator, const Block& block) {
+    const float gx = generator.vector.GetX();
+    const float gy = generator.vector.GetY();
+    const float gz = generator.vector.GetZ();
+
+    if (generator.tags == ForceGenerator::ALL_PARTICLES) {
+        for (std::size_t i = 0; i < block.count; ++i) {
+            block.ax[i] += gx;
+            block.ay[i] += gy;
+            block.az[i] += gz;
+        }
+        return;
+    }
+
+    for (std::size_t i = 0; i < block.count; ++i) {
+        const float weight = Selects(generator.tags, block.tags[i]);
+        block.ax[i] += weight * gx;
+        block.ay[i] += weight * gy;
+        block.az[i] += weight * gz;
+    }
+}
+
+void ApplyDrag(const ForceGenerator& generator, const Block& block) {
+    const float ux = generator.vector.GetX();
+    const float uy = generator.vector.GetY();
+    const float uz = generator.vector.GetZ();
+    const float coefficient = generator.coefficient;
+    const bool all = generator.tags == ForceGenerator::ALL_PARTICLES;
+
+    for (std::size_t i = 0; i < block.count; ++i) {
+        // Velocity of the fluid relative to the particle
+        const float rx = ux - block.vx[i];
+        const float ry = uy - block.vy[i];
+        const float rz = uz - block.vz[i];
+        const float speed = std::sqrt(rx * rx + ry * ry + rz * rz);
+        const float weight =
+            all ? 1.0f : Selects(generator.tags, block.tags[i]);
+        const float scale =
+            weight * coefficient * speed * block.inverse_mass[i];
+        block.ax[i] += scale * rx;
+        block.ay[i] += scale * ry;
+        block.az[i] += scale * rz;
+    }
+}
+
+}  // namespace
+
+ForceGenerator ForceGenerator::Gravity(const math::Vector& acceleration,
+                                       std::uint32_t tags) {
+    ForceGenerator generator;
+    generator.type = ForceType::Uniform;
+    generator.vector = acceleration;
+    generator.tags = tags;
+    return generator;
+}
+
+ForceGenerator ForceGenerator::Drag(float coefficient, std::uint32_t tags) {
+    return Wind(math::Vector(0.0f, 0.0f, 0.0f), coefficient, tags);
+}
+
+ForceGenerator ForceGenerator::Wind(const math::Vector& velocity,
+                                    float coefficient, std::uint32_t tags) {
+    ForceGenerator generator;
+    generator.type = ForceType::Drag;
+    generator.vector = velocity;
+    generator.coefficient = coefficient;
+    generator.tags = tags;
+    return generator;
+}
+
+ForceGenerator ForceGenerator::Current(const math::Vector& velocity,
+                                       float coefficient, std::uint32_t tags) {
+    return Wind(velocity, coefficient, tags);
+}
+
+ForceGeneratorId ForceRegistry::Add(const ForceGenerator& generator) {
+    mGenerators.push_back(generator);
+    mIds.push_back(mNextId);
+    return mNextId++;
+}
+
+bool ForceRegistry::Remove(ForceGeneratorId id) {
+    const auto found = std::find(mIds.begin(), mIds.end(), id);
+    if (found == mIds.end()) {
+        return false;
+    }
+
+    // Keep registration order so the summation order does not change.
+    const auto index = std::distance(mIds.begin(), found);
+    mIds.erase(found);
+    mGenerators.erase(mGenerators.begin() + index);
+    return true;
+}
+
+const ForceGenerator* ForceRegistry::Find(ForceGeneratorId id) const {
+    const auto found = std::find(mIds.begin(), mIds.end(), id);
+    if (found == mIds.end()) {
+        return nullptr;
+    }
+    return &mGenerators[static_cast<std::size_t>(
+        std::distance(mIds.begin(), found))];
+}
+
+void ForceRegistry::Clear() {
+    mGenerators.clear();
+    mIds.clear();
+}
+
+void ForceRegistry::Apply(const ParticleStore& store,
+                          VectorColumns<float>& acceleration,
+                          threading::ThreadPool* pool) const {
+    // Sleeping particles are not integrated, so their entries are skipped.
+    Apply(store, 0, store.GetAwakeCount(), acceleration, pool);
+}
+
+void ForceRegistry::Apply(const ParticleStore& store, std::size_t begin,
+                          std::size_t end, VectorColumns<float>& acceleration,
+                          threading::ThreadPool* pool) const {
+    acceleration.x.resize(store.size());
+    acceleration.y.resize(store.size());
+    acceleration.z.resize(store.size());
+
+    threading::ParallelFor(pool, end - begin, kForceChunkSize,
+                           [&](std::size_t first, std::size_t last) {
+                               ApplyRange(store, acceleration, begin + first,
+                                          begin + last);
+                           });
+}
+
+void ForceRegistry::ApplyRange(const ParticleStore& store,
+                               VectorColumns<float>& acceleration,
+                               std::size_t begin, std::size_t end) const {
+    const bool has_drag =
+        std::any_of(mGenerators.begin(), mGenerators.end(),
+                    [](const ForceGenerator& generator) {
+                        return generator.type == ForceType::Drag;
+                    });
+
+    const VectorColumns<float>& own = store.Acceleration();
+    const VectorColumns<float>& velocity = store.Velocity();
+    const std::vector<double>& mass = store.Mass();
+    std::array<float, kForceBlockSize> inverse_mass;
+
+    for (std::size_t first = begin; first < end; first += kForceBlockSize) {
+        Block block{};
+        block.count = std::min(kForceBlockSize, end - first);
+        block.vx = velocity.x.data() + first;
+        block.vy = velocity.y.data() + first;
+        block.vz = velocity.z.data() + first;
+        block.tags = store.Tags().data() + first;
+        block.inverse_mass = inverse_mass.data();
+        block.ax = acceleration.x.data() + first;
+        block.ay = acceleration.y.data() + first;
+        block.az = acceleration.z.data() + first;
+
+        std::copy_n(own.x.data() + first, block.count, block.ax);
+        std::copy_n(own.y.data() + first, block.count, block.ay);
+        std::copy_n(own.z.data() + first, block.count, block.az);
+
+        if (has_drag) {
+            // Massless particles would divide by zero; leave them undragged.
+            for (std::size_t i = 0; i < block.count; ++i) {
+                const double m = mass[first + i];
+                inverse_mass[i] =
+                    m > 0.0 ? static_cast<float>(1.0 / m) : 0.0f;
+            }
+        }
+
+        for (const ForceGenerator& generator : mGenerators) {
+            switch (generator.type) {
+                case ForceType::Uniform:
+                    ApplyUniform(generator, block);
+                    break;
+                case ForceType::Drag:
+                    ApplyDrag(generator, block);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
+
+}  // namespace physics
+}  // namespace solo
@@ -0,0 +1,207 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Physics/SpatialGrid.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Particle/ParticleStore.h"
+#include "Physics/RadixSort.h"
+#include "Threading/ThreadPool.h"
+
+namespace solo {
+namespace physics {
+
+namespace {
+
+// Particles hashed per pool chunk
+constexpr std::size_t kBuildChunkSize = 16384;
+
+// Smallest bucket table, so tiny stores still spread across buckets
+constexpr std::size_t kMinimumBucketCount = 64;
+
+bool CloserThan(const Neighbour& left, const Neighbour& right) {
+    return left.distance_squared < right.distance_squared;
+}
+
+}  // namespace
+
+SpatialGrid::SpatialGrid(double cell_size) { SetCellSize(cell_size); }
+
+void SpatialGrid::SetCellSize(double cell_size) {
+    if (!(cell_size > 0.0) || !std::isfinite(cell_size)) {
+        throw std::invalid_argument(
+            "Spatial grid cell size must be positive and finite");
+    }
+    mCellSize = cell_size;
+    mInverseCellSize = 1.0 / cell_size;
+}
+
+void SpatialGrid::Build(const ParticleStore& store,
+                        threading::ThreadPool* pool) {
+    const std::size_t count = store.size();
+    const std::size_t bucket_count =
+        std::bit_ceil(std::max(count * 2, kMinimumBucketCount));
+    mBucketMask = bucket_count - 1;
+
+    const VectorColumns<double>& position = store.Position();
+    const double* px = position.x.data();
+    const double* py = position.y.data();
+    const double* pz = position.z.data();
+
+    // Key every particle by bucket in the high half, dense index in the low.
+    mKeys.resize(count);
+    threading::ParallelFor(
+        pool, count, kBuildChunkSize, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const auto bucket = static_cast<std::uint64_t>(
+                    BucketOf(CellOf(px[i], py[i], pz[i])));
+                mKeys[i] = bucket << 32 | static_cast<std::uint64_t>(i);
+            }
+        });
+
+    // Radix sort on the bucket. Each pass streams through the keys, which
+    // is far cheaper than scattering straight into a bucket table many
+    // times larger than the cache.
+    RadixSort(
+        mKeys, mSortScratch,
+        [](std::uint64_t key) { return key >> 32; },
+        static_cast<std::size_t>(std::bit_width(mBucketMask)));
+
+    // Split the sorted keys into entries and bucket starts.
+    mEntries.resize(count);
+    mBucketStart.resize(bucket_count + 1);
+    std::size_t next_bucket = 0;
+    for (std::size_t entry = 0; entry < count; ++entry) {
+        const std::size_t bucket = mKeys[entry] >> 32;
+        while (next_bucket <= bucket) {
+            mBucketStart[next_bucket++] = static_cast<std::uint32_t>(entry);
+        }
+        mEntries[entry] = static_cast<std::uint32_t>(mKeys[entry]);
+    }
+    while (next_bucket <= bucket_count) {
+        mBucketStart[next_bucket++] = static_cast<std::uint32_t>(count);
+    }
+
+    // Gather the positions into bucket order for the queries
+    mPoints.resize(count);
+    threading::ParallelFor(
+        pool, count, kBuildChunkSize, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t entry = begin; entry < end; ++entry) {
+                const std::uint32_t index = mEntries[entry];
+                mPoints[entry] = {px[index], py[index], pz[index]};
+            }
+        });
+}
+
+void SpatialGrid::QueryRadius(const math::WorldCoordinates& center,
+                              double radius,
+                              std::vector<std::size_t>& result) const {
+    result.clear();
+    ForEachInRadius(center, radius, [&result](std::size_t index, double) {
+        result.push_back(index);
+    });
+}
+
+void SpatialGrid::QueryBox(const math::WorldCoordinates& minimum,
+                           const math::WorldCoordinates& maximum,
+                           std::vector<std::size_t>& result) const {
+    result.clear();
+    ForEachInBox(minimum, maximum,
+                 [&result](std::size_t index) { result.push_back(index); });
+}
+
+void SpatialGrid::QueryNearest(const math::WorldCoordinates& center,
+                               std::size_t count,
+                               std::vector<Neighbour>& result) const {
+    result.clear();
+    if (count == 0 || mEntries.empty()) {
+        return;
+    }
+
+    const double cx = center.GetX();
+    const double cy = center.GetY();
+    const double cz = center.GetZ();
+
+    // result is kept as a max-heap of the best candidates so far.
+    std::size_t visited = 0;
+    const auto consider = [&](std::size_t entry) {
+        ++visited;
+        const double dx = mPoints[entry].x - cx;
+        const double dy = mPoints[entry].y - cy;
+        const double dz = mPoints[entry].z - cz;
+        const Neighbour candidate{mEntries[entry], dx * dx + dy * dy + dz * dz};
+        if (result.size() < count) {
+            result.push_back(candidate);
+            std::push_heap(result.begin(), result.end(), CloserThan);
+        } else if (CloserThan(candidate, result.front())) {
+            std::pop_heap(result.begin(), result.end(), CloserThan);
+            result.back() = candidate;
+            std::push_heap(result.begin(), result.end(), CloserThan);
+        }
+    };
+
+    // Search shells of cells at growing Chebyshev distance from the centre
+    // cell. Anything beyond shell r is at least r cells away, so the search
+    // stops once the k-th best is closer than that.
+    const GridCell origin = CellOf(cx, cy, cz);
+    std::size_t cells_searched = 0;
+    bool exhaustive = false;
+    for (std::int64_t r = 0; visited < mEntries.size(); ++r) {
+        const auto side = static_cast<std::size_t>(2 * r + 1);
+        cells_searched += side * side * side;
+        if (cells_searched > mEntries.size()) {
+            exhaustive = true;
+            break;
+        }
+
+        GridCell cell;
+        for (std::int64_t dz = -r; dz <= r; ++dz) {
+            for (std::int64_t dy = -r; dy <= r; ++dy) {
+                // Interior rows only touch the shell at their two ends.
+                const bool face = std::abs(dz) == r || std::abs(dy) == r;
+                const std::int64_t step = face || r == 0 ? 1 : 2 * r;
+                for (std::int64_t dx = -r; dx <= r; dx += step) {
+                    cell.x = origin.x + dx;
+                    cell.y = origin.y + dy;
+                    cell.z = origin.z + dz;
+                    ForEachInCell(cell, consider);
+                }
+            }
+        }
+
+        const double reach = static_cast<double>(r) * mCellSize;
+        if (result.size() == count &&
+            result.front().distance_squared <= reach * reach) {
+            break;
+        }
+    }
+
+    if (exhaustive) {
+        result.clear();
+        for (std::size_t entry = 0; entry < mEntries.size(); ++entry) {
+            consider(entry);
+        }
+    }
+
+    std::sort_heap(result.begin(), result.end(), CloserThan);
+}
+
+}  // namespace physics
+}  // namespace solo
@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Threading/ThreadPlacement.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Affinity, FIFO scheduling and page release are Linux interfaces; other
+// platforms report the placement as not applied.
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace solo {
+namespace threading {
+
+#ifdef __linux__
+
+bool PlaceCurrentThread(const ThreadPlacement& placement) {
+    bool placed = true;
+
+    if (!placement.cpus.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (const std::size_t cpu : placement.cpus) {
+            if (cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &set);
+            } else {
+                placed = false;
+            }
+        }
+        placed = pthread_setaffinity_np(pthread_self(), sizeof(set), &set) ==
+                     0 &&
+                 placed;
+    }
+
+    if (placement.realtime_priority > 0) {
+        sched_param parameters{};
+        parameters.sched_priority = placement.realtime_priority;
+        placed = pthread_setschedparam(pthread_self(), SCHED_FIFO,
+                                       &parameters) == 0 &&
+                 placed;
+    }
+
+    return placed;
+}
+
+bool ReleasePages(void* data, std::size_t bytes) {
+    const auto page = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = reinterpret_cast<std::uintptr_t>(data);
+
+    // Only pages wholly inside the buffer; the partial pages at either end
+    // may hold other allocations.
+    const std::uintptr_t first = (begin + page - 1) / page * page;
+    const std::uintptr_t last = (begin + bytes) / page * page;
+    if (last <= first) {
+        return true;
+    }
+    return madvise(reinterpret_cast<void*>(first), last - first,
+                   MADV_DONTNEED) == 0;
+}
+
+#else
+
+bool PlaceCurrentThread(const ThreadPlacement& placement) {
+    return placement.cpus.empty() && placement.realtime_priority == 0;
+}
+
+bool ReleasePages(void* /*data*/, std::size_t /*bytes*/) { return false; }
+
+#endif
+
+}  // namespace threading
+}  // namespace solo
@@ -0,0 +1,171 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Threading/ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <latch>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Threading/ThreadPlacement.h"
+
+namespace solo {
+namespace threading {
+
+namespace {
+
+// Number of polls a thread makes before parking on a futex wait. Ticks are
+// issued back to back at high rates, so a short spin avoids the wake-up
+// latency of the kernel in the common case.
+constexpr int kSpinCount = 4096;
+
+}  // namespace
+
+ThreadPool::ThreadPool(std::size_t thread_count)
+    : ThreadPool(thread_count, {}) {}
+
+ThreadPool::ThreadPool(std::size_t thread_count,
+                       const std::vector<ThreadPlacement>& placements) {
+    if (thread_count == 0) {
+        thread_count = std::max<std::size_t>(
+            1, static_cast<std::size_t>(std::thread::hardware_concurrency()));
+    }
+
+    mQueueCount = thread_count;
+    mQueues = std::make_unique<ChunkQueue[]>(mQueueCount);
+
+    mWorkers.reserve(mQueueCount - 1);
+    std::atomic<std::size_t> failures{0};
+    std::latch placed(static_cast<std::ptrdiff_t>(mQueueCount - 1));
+    for (std::size_t i = 1; i < mQueueCount; ++i) {
+        const ThreadPlacement placement =
+            i - 1 < placements.size() ? placements[i - 1] : ThreadPlacement{};
+        mWorkers.emplace_back([this, i, placement, &failures, &placed] {
+            if (!PlaceCurrentThread(placement)) {
+                failures.fetch_add(1, std::memory_order_relaxed);
+            }
+            placed.count_down();
+            WorkerLoop(i);
+        });
+    }
+    placed.wait();
+    mPlacementFailures = failures.load(std::memory_order_relaxed);
+}
+
+ThreadPool::~ThreadPool() {
+    mStopping.store(true, std::memory_order_release);
+    mGeneration.fetch_add(1, std::memory_order_release);
+    mGeneration.notify_all();
+
+    for (std::thread& worker : mWorkers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void ThreadPool::Run(std::size_t count, std::size_t grain,
+                     RangeFunction function, void* context) {
+    if (count == 0) {
+        return;
+    }
+
+    grain = std::max<std::size_t>(grain, 1);
+    const std::size_t chunk_count = (count + grain - 1) / grain;
+
+    // Nothing to share, run on the calling thread.
+    if (mWorkers.empty() || chunk_count == 1) {
+        for (std::size_t begin = 0; begin < count; begin += grain) {
+            function(context, begin, std::min(begin + grain, count));
+        }
+        return;
+    }
+
+    mFunction = function;
+    mContext = context;
+    mCount = count;
+    mGrain = grain;
+
+    // Deal the chunks out evenly, one contiguous block per participant.
+    for (std::size_t i = 0; i < mQueueCount; ++i) {
+        mQueues[i].next.store((i * chunk_count) / mQueueCount,
+                              std::memory_order_relaxed);
+        mQueues[i].end = ((i + 1) * chunk_count) / mQueueCount;
+    }
+
+    mBusyWorkers.store(mWorkers.size(), std::memory_order_relaxed);
+    mGeneration.fetch_add(1, std::memory_order_release);
+    mGeneration.notify_all();
+
+    ExecuteChunks(0);
+
+    // The job is complete once every worker has drained out of it.
+    int spins = 0;
+    std::size_t busy = mBusyWorkers.load(std::memory_order_acquire);
+    while (busy != 0) {
+        if (++spins > kSpinCount) {
+            mBusyWorkers.wait(busy, std::memory_order_acquire);
+        }
+        busy = mBusyWorkers.load(std::memory_order_acquire);
+    }
+}
+
+void ThreadPool::WorkerLoop(std::size_t queue_index) {
+    std::uint64_t seen = 0;
+
+    while (true) {
+        int spins = 0;
+        std::uint64_t generation = mGeneration.load(std::memory_order_acquire);
+        while (generation == seen) {
+            if (++spins > kSpinCount) {
+                mGeneration.wait(seen, std::memory_order_acquire);
+            }
+            generation = mGeneration.load(std::memory_order_acquire);
+        }
+        seen = generation;
+
+        if (mStopping.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        ExecuteChunks(queue_index);
+
+        if (mBusyWorkers.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            mBusyWorkers.notify_one();
+        }
+    }
+}
+
+void ThreadPool::ExecuteChunks(std::size_t queue_index) {
+    // Drain our own queue first, then visit the others and steal from them.
+    for (std::size_t offset = 0; offset < mQueueCount; ++offset) {
+        ChunkQueue& queue = mQueues[(queue_index + offset) % mQueueCount];
+
+        while (true) {
+            const std::size_t chunk =
+                queue.next.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= queue.end) {
+                break;
+            }
+
+            const std::size_t begin = chunk * mGrain;
+            mFunction(mContext, begin, std::min(begin + mGrain, mCount));
+        }
+    }
+}
+
+}  // namespace threading
+}  // namespace solo
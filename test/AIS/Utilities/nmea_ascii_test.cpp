@@ -14,6 +14,8 @@
 #include <gtest/gtest.h>
 
 #include <bitset>
+#include <memory_resource>
+#include <string>
 
 // anonymous namespace to prevent name collisions
 namespace {
@@ -54,4 +56,17 @@ TEST(nmea_ascii_test, NonMultipleOf6BitsConversion) {
                          std::bitset<14>("11111110011111")));
 }
 
+TEST(nmea_ascii_test, ArmoursIntoTheGivenResource) {
+    // Any allocation past the buffer would throw.
+    char buffer[64];
+    std::pmr::monotonic_buffer_resource arena(
+        buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    // Long enough to need storage outside the string object.
+    const std::pmr::string result = solo::ais::utilities::ToNmeaAscii(
+        std::bitset<168>().set(), &arena);
+    EXPECT_EQ(std::pmr::string(28, 'w'), result);
+    EXPECT_EQ(&arena, result.get_allocator().resource());
+}
+
 }  // namespace
@@ -0,0 +1,252 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/Checkpoint.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Math/Vector.h"
+#include "Particle/Particle.h"
+#include "Particle/ParticleHandle.h"
+#include "Particle/ParticleStore.h"
+#include "Physics/EmitterRegistry.h"
+
+namespace {
+
+using solo::engine::Checkpoint;
+using solo::engine::Engine;
+using solo::physics::Particle;
+using solo::physics::ParticleHandle;
+
+class CheckpointTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mPath = std::filesystem::temp_directory_path() /
+                ("solo_checkpoint_" +
+                 std::string(::testing::UnitTest::GetInstance()
+                                 ->current_test_info()
+                                 ->name()) +
+                 ".bin");
+    }
+
+    void TearDown() override { std::filesystem::remove(mPath); }
+
+    std::filesystem::path mPath;
+};
+
+Particle MakeParticle(int i) {
+    Particle particle(1.0 + i);
+    particle.SetPosition(solo::math::WorldCoordinates(i, 2.0 * i, -i));
+    const auto value = static_cast<float>(i);
+    particle.SetVelocity(solo::math::Vector(0.5f * value, 1.0f, 0.0f));
+    particle.SetAngularVelocity(solo::math::Vector(0.0f, 0.0f, 0.25f * value));
+    particle.SetTags(static_cast<std::uint32_t>(i % 3));
+    return particle;
+}
+
+TEST_F(CheckpointTest, round_trip_restores_state_and_handles) {
+    Engine engine;
+    std::vector<ParticleHandle> handles;
+    for (int i = 0; i < 100; ++i) {
+        handles.push_back(engine.AddParticle(MakeParticle(i)));
+    }
+    engine.RemoveParticle(handles[10]);
+    engine.RemoveParticle(handles[50]);
+    for (int i = 0; i < 3; ++i) {
+        engine.UpdateParticles(0.5);
+    }
+    engine.SaveCheckpoint(mPath);
+    EXPECT_EQ(0u, std::filesystem::file_size(mPath) % Checkpoint::ALIGNMENT);
+
+    Engine restored;
+    restored.LoadCheckpoint(mPath);
+    EXPECT_EQ(3u, restored.GetTickCount());
+    EXPECT_DOUBLE_EQ(1.5, restored.GetSimulationTime());
+    ASSERT_EQ(engine.GetParticleCount(), restored.GetParticleCount());
+
+    const auto& expected = engine.GetParticles();
+    const auto& actual = restored.GetParticles();
+    EXPECT_EQ(expected.Handles(), actual.Handles());
+    EXPECT_EQ(expected.Mass(), actual.Mass());
+    EXPECT_EQ(expected.Position().x, actual.Position().x);
+    EXPECT_EQ(expected.Position().z, actual.Position().z);
+    EXPECT_EQ(expected.Velocity().x, actual.Velocity().x);
+    EXPECT_EQ(expected.AngularVelocity().z, actual.AngularVelocity().z);
+    EXPECT_EQ(expected.Tags(), actual.Tags());
+
+    // Live handles resolve, removed ones stay stale, and freed slots are
+    // reused under a newer generation.
+    EXPECT_EQ(expected.IndexOf(handles[99]), actual.IndexOf(handles[99]));
+    EXPECT_FALSE(actual.Contains(handles[10]));
+    const ParticleHandle reused = restored.AddParticle(MakeParticle(0));
+    EXPECT_FALSE(reused == handles[10] || reused == handles[50]);
+    EXPECT_TRUE(restored.GetParticles().Contains(reused));
+}
+
+// Slow rate group, sleeping and a burst emitter, set up alike on the engine
+// that saves and the one that loads.
+solo::physics::EmitterId Configure(Engine& engine) {
+    engine.AddRateGroup(4);
+    solo::engine::SleepSettings settings;
+    settings.ticks = 3;
+    engine.EnableSleeping(settings);
+
+    solo::physics::Emitter emitter;
+    emitter.velocity = solo::math::Vector(0.0f, 1.0f, 0.0f);
+    emitter.velocity_spread = solo::math::Vector(0.5f, 0.5f, 0.5f);
+    emitter.lifetime = 1.0;
+    emitter.lifetime_spread = 0.5;
+    return engine.AddEmitter(emitter);
+}
+
+TEST_F(CheckpointTest, round_trip_keeps_schedule_sleep_and_lifetimes) {
+    Engine engine;
+    const auto emitter = Configure(engine);
+    std::vector<ParticleHandle> handles;
+    for (int i = 0; i < 12; ++i) {
+        Particle particle = MakeParticle(i);
+        if (i % 3 == 0) {
+            particle.SetVelocity(solo::math::Vector());
+            particle.SetAngularVelocity(solo::math::Vector());
+        }
+        handles.push_back(engine.AddParticle(particle));
+        if (i % 2 == 0) {
+            engine.SetParticleRateGroup(handles.back(), 1);
+        }
+    }
+    engine.EmitBurst(emitter, 20);
+    for (int i = 0; i < 6; ++i) {
+        engine.UpdateParticles(0.1);
+    }
+    // Joins the slow group between its updates.
+    engine.SetParticleRateGroup(handles[1], 1);
+    const std::size_t awake = engine.GetAwakeParticleCount();
+    ASSERT_LT(awake, engine.GetParticleCount());
+    engine.SaveCheckpoint(mPath);
+
+    Engine restored;
+    Configure(restored);
+    restored.LoadCheckpoint(mPath);
+    EXPECT_EQ(awake, restored.GetAwakeParticleCount());
+    const auto& expected = engine.GetParticles();
+    const auto& actual = restored.GetParticles();
+    EXPECT_EQ(expected.Groups(), actual.Groups());
+    EXPECT_EQ(expected.IdleTicks(), actual.IdleTicks());
+
+    // Both carry on alike: slow phases, the joiner, sleepers and expiring
+    // emitted particles.
+    const auto live = [](const Engine& source, solo::physics::EmitterId id) {
+        return source.GetWorld(Engine::DEFAULT_WORLD)
+            .GetEmitters()
+            .GetLiveCount(id);
+    };
+    EXPECT_EQ(20u, live(restored, emitter));
+    for (int i = 0; i < 12; ++i) {
+        engine.UpdateParticles(0.1);
+        restored.UpdateParticles(0.1);
+        ASSERT_EQ(engine.GetParticleCount(), restored.GetParticleCount());
+        EXPECT_EQ(live(engine, emitter), live(restored, emitter));
+        EXPECT_EQ(engine.GetAwakeParticleCount(),
+                  restored.GetAwakeParticleCount());
+        EXPECT_EQ(expected.Handles(), actual.Handles());
+        EXPECT_EQ(expected.Position().x, actual.Position().x);
+        EXPECT_EQ(expected.Position().y, actual.Position().y);
+    }
+    EXPECT_EQ(0u, live(restored, emitter));
+    EXPECT_EQ(handles.size(), restored.GetParticleCount());
+}
+
+TEST_F(CheckpointTest, other_rate_groups_are_refused) {
+    Engine engine;
+    engine.AddRateGroup(4);
+    engine.AddParticle(MakeParticle(1));
+    engine.SaveCheckpoint(mPath);
+
+    Engine target;
+    target.AddRateGroup(2);
+    target.AddParticle(MakeParticle(7));
+    EXPECT_THROW(target.LoadCheckpoint(mPath), std::runtime_error);
+    ASSERT_EQ(1u, target.GetParticleCount());
+    EXPECT_DOUBLE_EQ(7.0, target.GetParticles()[0].GetPosition().GetX());
+}
+
+TEST_F(CheckpointTest, empty_store_round_trips) {
+    Engine engine;
+    engine.SaveCheckpoint(mPath);
+
+    Engine restored;
+    restored.AddParticle(MakeParticle(1));
+    restored.LoadCheckpoint(mPath);
+    EXPECT_EQ(0u, restored.GetParticleCount());
+}
+
+TEST_F(CheckpointTest, engines_with_several_worlds_are_refused) {
+    Engine engine;
+    engine.AddParticle(MakeParticle(1));
+    engine.SaveCheckpoint(mPath);
+
+    Engine sharded;
+    sharded.AddWorld();
+    EXPECT_THROW(sharded.SaveCheckpoint(mPath), std::logic_error);
+    EXPECT_THROW(sharded.LoadCheckpoint(mPath), std::logic_error);
+    EXPECT_EQ(0u, sharded.GetParticleCount());
+}
+
+TEST_F(CheckpointTest, invalid_files_leave_engine_unchanged) {
+    Engine engine;
+    for (int i = 0; i < 10; ++i) {
+        engine.AddParticle(MakeParticle(i));
+    }
+    engine.SaveCheckpoint(mPath);
+
+    Engine target;
+    target.AddParticle(MakeParticle(7));
+
+    // Truncated
+    std::filesystem::resize_file(mPath,
+                                 std::filesystem::file_size(mPath) - 1);
+    EXPECT_THROW(target.LoadCheckpoint(mPath), std::runtime_error);
+
+    // Not a checkpoint
+    {
+        std::ofstream file(mPath, std::ios::binary | std::ios::trunc);
+        file << std::string(8192, 'x');
+    }
+    EXPECT_THROW(target.LoadCheckpoint(mPath), std::runtime_error);
+
+    // Missing
+    std::filesystem::remove(mPath);
+    EXPECT_THROW(target.LoadCheckpoint(mPath), std::runtime_error);
+
+    ASSERT_EQ(1u, target.GetParticleCount());
+    EXPECT_DOUBLE_EQ(7.0, target.GetParticles()[0].GetPosition().GetX());
+}
+
+TEST_F(CheckpointTest, refuses_while_running) {
+    Engine engine;
+    engine.Start(1000.0);
+    EXPECT_THROW(engine.SaveCheckpoint(mPath), std::logic_error);
+    EXPECT_THROW(engine.LoadCheckpoint(mPath), std::logic_error);
+    engine.Stop();
+}
+
+}  // namespace
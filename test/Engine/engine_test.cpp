@@ -1,9 +1,17 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 #include "Engine/Engine.h"
 #include "Particle/Particle.h"
 #include "Math/Vector.h"
+#include "Physics/EmitterRegistry.h"
+#include "Physics/ForceRegistry.h"
+#include "Physics/SpatialGrid.h"
 
 namespace solo {
 namespace engine {
@@ -22,6 +30,24 @@ TEST_F(EngineLoopTest, StartAndStop) {
     EXPECT_FALSE(mEngine.IsRunning());
 }
 
+TEST_F(EngineLoopTest, StoppedOnlySettersThrowWhileRunning) {
+    mEngine.Start(100.0);
+    EXPECT_THROW(mEngine.EnableSnapshots(), std::logic_error);
+    EXPECT_THROW(mEngine.EnableSpatialIndex(1.0), std::logic_error);
+    EXPECT_THROW(mEngine.EnableBroadPhase(), std::logic_error);
+    EXPECT_THROW(mEngine.EnableGravity(), std::logic_error);
+    EXPECT_THROW(mEngine.AddForceGenerator(physics::ForceGenerator::Drag(0.1f)),
+                 std::logic_error);
+    EXPECT_THROW(mEngine.RemoveForceGenerator(0), std::logic_error);
+    EXPECT_THROW(mEngine.EnableSleeping(), std::logic_error);
+    EXPECT_THROW(mEngine.AddRateGroup(2), std::logic_error);
+    EXPECT_THROW(mEngine.AddEmitter(physics::Emitter()), std::logic_error);
+    EXPECT_THROW(mEngine.RemoveEmitter(0), std::logic_error);
+    EXPECT_THROW(mEngine.EnableMortonOrder(10), std::logic_error);
+    mEngine.Stop();
+    EXPECT_NO_THROW(mEngine.EnableSnapshots());
+}
+
 TEST_F(EngineLoopTest, SimulationUpdatesParticles) {
     physics::Particle particle;
     particle.SetPosition(math::WorldCoordinates(0.0f, 0.0f, 0.0f));
@@ -45,6 +71,592 @@ TEST_F(EngineLoopTest, SimulationUpdatesParticles) {
     EXPECT_GT(particles[0].GetPosition().GetX(), 0.1f);
 }
 
+TEST_F(EngineLoopTest, UpdateParticlesMatchesParticleUpdate) {
+    physics::Particle particle(2.0);
+    particle.SetPosition(math::WorldCoordinates(1.0, -2.0, 3.0));
+    particle.SetVelocity(math::Vector(1.5f, 0.0f, -4.0f));
+    particle.SetAcceleration(math::Vector(0.0f, -9.8f, 1.0f));
+    particle.SetAngularVelocity(math::Vector(0.1f, 0.2f, 0.3f));
+    particle.SetAngularAcceleration(math::Vector(0.0f, -1.0f, 2.0f));
+
+    mEngine.AddParticle(particle);
+    mEngine.AddParticle(particle);
+
+    for (int step = 0; step < 10; ++step) {
+        mEngine.UpdateParticles(0.05);
+        particle.Update(0.05);
+    }
+
+    auto& particles = mEngine.GetParticles();
+    for (std::size_t i = 0; i < particles.size(); ++i) {
+        EXPECT_EQ(particles[i].GetPosition(), particle.GetPosition());
+        EXPECT_EQ(particles[i].GetVelocity(), particle.GetVelocity());
+        EXPECT_EQ(particles[i].GetAngle(), particle.GetAngle());
+        EXPECT_EQ(particles[i].GetAngularVelocity(),
+                  particle.GetAngularVelocity());
+    }
+}
+
+TEST_F(EngineLoopTest, ThreadedTickUpdatesEveryChunk) {
+    constexpr int particle_count = 50000;
+    constexpr int velocity_classes = 7;
+    for (int i = 0; i < particle_count; ++i) {
+        physics::Particle particle;
+        particle.SetVelocity(
+            math::Vector(static_cast<float>(1 + (i % velocity_classes)), 0.0f,
+                         0.0f));
+        mEngine.AddParticle(particle);
+    }
+
+    mEngine.Start(200.0, 4);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    mEngine.Stop();
+
+    // Every tick must finish all chunks, so particles sharing a velocity
+    // end up in exactly the same place.
+    auto& particles = mEngine.GetParticles();
+    EXPECT_GT(particles[0].GetPosition().GetX(), 0.0);
+    for (std::size_t i = velocity_classes; i < particles.size(); ++i) {
+        ASSERT_EQ(particles[i % velocity_classes].GetPosition(),
+                  particles[i].GetPosition());
+    }
+}
+
+TEST_F(EngineLoopTest, CommandsApplyImmediatelyWhenStopped) {
+    std::vector<physics::ParticleHandle> handles;
+    for (int i = 0; i < 3; ++i) {
+        physics::Particle particle;
+        particle.SetPosition(math::WorldCoordinates(i, 0.0, 0.0));
+        handles.push_back(mEngine.AddParticle(particle));
+    }
+
+    mEngine.SetParticleVelocity(handles[0], math::Vector(1.0f, 2.0f, 3.0f));
+    mEngine.SetParticleAcceleration(handles[2],
+                                    math::Vector(0.0f, 0.0f, -9.8f));
+    EXPECT_EQ(math::Vector(1.0f, 2.0f, 3.0f),
+              mEngine.GetParticles()[0].GetVelocity());
+
+    // Removal swaps the last particle into the freed index.
+    mEngine.RemoveParticle(handles[0]);
+    ASSERT_EQ(2u, mEngine.GetParticleCount());
+    auto& particles = mEngine.GetParticles();
+    EXPECT_EQ(0u, particles.IndexOf(handles[2]));
+    EXPECT_DOUBLE_EQ(2.0, particles[0].GetPosition().GetX());
+    EXPECT_FLOAT_EQ(-9.8f, particles[0].GetAcceleration().GetZ());
+
+    // Stale handles are ignored.
+    mEngine.RemoveParticle(handles[0]);
+    mEngine.SetParticleVelocity(handles[0], math::Vector(5.0f, 5.0f, 5.0f));
+    EXPECT_EQ(2u, mEngine.GetParticleCount());
+}
+
+TEST_F(EngineLoopTest, HandlesFromRunningEngineResolveAfterTick) {
+    mEngine.Start(500.0);
+    const auto handle = mEngine.AddParticle(physics::Particle(4.0));
+    mEngine.SetParticleVelocity(handle, math::Vector(1.0f, 0.0f, 0.0f));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    mEngine.RemoveParticle(handle);
+    mEngine.Stop();
+
+    EXPECT_FALSE(mEngine.GetParticles().Contains(handle));
+    EXPECT_EQ(0u, mEngine.GetParticleCount());
+}
+
+TEST_F(EngineLoopTest, ProducersAddWhileRunning) {
+    constexpr int producer_count = 4;
+    constexpr int per_producer = 2500;
+
+    mEngine.Start(500.0, 2);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producer_count; ++p) {
+        producers.emplace_back([this]() {
+            for (int i = 0; i < per_producer; ++i) {
+                mEngine.AddParticle(physics::Particle());
+            }
+        });
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    mEngine.Stop();
+
+    EXPECT_EQ(static_cast<std::size_t>(producer_count * per_producer),
+              mEngine.GetParticleCount());
+}
+
+TEST_F(EngineLoopTest, ProducersAddAcrossStartAndStop) {
+    constexpr int per_producer = 20000;
+
+    // The producer keeps submitting while the loop starts and stops
+    // underneath it; no command may be lost or applied mid-tick.
+    std::thread producer([this]() {
+        for (int i = 0; i < per_producer; ++i) {
+            mEngine.AddParticle(physics::Particle());
+        }
+    });
+    for (int cycle = 0; cycle < 20; ++cycle) {
+        mEngine.Start(1000.0, 2);
+        mEngine.Stop();
+        mEngine.RunFor(0.002, 0.001);
+    }
+    producer.join();
+
+    EXPECT_EQ(static_cast<std::size_t>(per_producer),
+              mEngine.GetParticleCount());
+}
+
+TEST_F(EngineLoopTest, StatsRecordEveryTick) {
+    mEngine.AddParticle(physics::Particle(1.0));
+    for (int i = 0; i < 10; ++i) {
+        mEngine.UpdateParticles(1.0);
+    }
+
+    const EngineStats stats = mEngine.GetStats();
+    EXPECT_EQ(10u, stats.tick.count);
+    EXPECT_EQ(10u, stats.integrate.count);
+    EXPECT_LE(stats.tick.p50, stats.tick.p99);
+    EXPECT_LE(stats.tick.p99, stats.tick.p999);
+    EXPECT_LE(stats.tick.p999, stats.tick.max);
+    EXPECT_GE(stats.tick.max, stats.integrate.max);
+    EXPECT_EQ(0u, stats.overruns);
+}
+
+TEST_F(EngineLoopTest, SpatialIndexFollowsTicks) {
+    mEngine.EnableSpatialIndex(1.0);
+    physics::Particle particle;
+    particle.SetVelocity(math::Vector(10.0f, 0.0f, 0.0f));
+    mEngine.AddParticle(particle);
+    mEngine.AddParticle(physics::Particle());
+    mEngine.UpdateParticles(1.0);
+
+    const physics::SpatialGrid* grid = mEngine.GetSpatialIndex();
+    ASSERT_NE(nullptr, grid);
+    std::vector<std::size_t> found;
+    grid->QueryRadius(math::WorldCoordinates(10.0, 0.0, 0.0), 0.5, found);
+    ASSERT_EQ(1u, found.size());
+    EXPECT_EQ(0u, found[0]);
+}
+
+TEST_F(EngineLoopTest, BroadPhaseReportsOverlaps) {
+    std::size_t reported = 0;
+    mEngine.EnableBroadPhase(
+        [&reported](const std::vector<physics::CollisionPair>& pairs) {
+            reported += pairs.size();
+        });
+
+    physics::Particle left;
+    left.SetRadius(1.0f);
+    physics::Particle right = left;
+    right.SetPosition(math::WorldCoordinates(3.0, 0.0, 0.0));
+    right.SetVelocity(math::Vector(-2.0f, 0.0f, 0.0f));
+    mEngine.AddParticle(left);
+    const auto moving = mEngine.AddParticle(right);
+
+    mEngine.UpdateParticles(0.25);
+    EXPECT_EQ(0u, reported);
+    EXPECT_TRUE(mEngine.GetCollisionPairs().empty());
+
+    mEngine.UpdateParticles(0.25);
+    ASSERT_EQ(1u, mEngine.GetCollisionPairs().size());
+    EXPECT_EQ(moving, mEngine.GetCollisionPairs()[0].second);
+    EXPECT_EQ(1u, reported);
+}
+
+TEST_F(EngineLoopTest, GravityPullsBodiesTogether) {
+    physics::BarnesHutSettings settings;
+    settings.gravitational_constant = 1.0;
+    mEngine.EnableGravity(settings);
+
+    physics::Particle left(100.0);
+    physics::Particle right(100.0);
+    right.SetPosition(math::WorldCoordinates(10.0, 0.0, 0.0));
+    const auto left_handle = mEngine.AddParticle(left);
+    mEngine.AddParticle(right);
+    mEngine.UpdateParticles(0.1);
+
+    auto& particles = mEngine.GetParticles();
+    const std::size_t index = particles.IndexOf(left_handle);
+    EXPECT_GT(particles[index].GetVelocity().GetX(), 0.0f);
+    EXPECT_GT(particles[1 - index].GetPosition().GetX(), 0.0);
+    EXPECT_LT(particles[1 - index].GetVelocity().GetX(), 0.0f);
+    // The gravity is applied per tick, not written into the particle.
+    EXPECT_FLOAT_EQ(0.0f, particles[index].GetAcceleration().GetX());
+    EXPECT_EQ(1u, mEngine.GetStats().forces.count);
+}
+
+TEST(EngineIntegratorTest, VerletFallsExactlyUnderGravity) {
+    Engine engine(physics::IntegratorType::VelocityVerlet);
+    EXPECT_EQ(physics::IntegratorType::VelocityVerlet, engine.GetIntegrator());
+    engine.AddForceGenerator(
+        physics::ForceGenerator::Gravity(math::Vector(0.0f, 0.0f, -10.0f)));
+    const auto handle = engine.AddParticle(physics::Particle(1.0));
+    for (int i = 0; i < 60; ++i) {
+        engine.UpdateParticles(1.0 / 60.0);
+    }
+
+    auto& particles = engine.GetParticles();
+    const std::size_t index = particles.IndexOf(handle);
+    EXPECT_NEAR(-5.0, particles[index].GetPosition().GetZ(), 1e-4);
+    EXPECT_NEAR(-10.0f, particles[index].GetVelocity().GetZ(), 1e-4f);
+
+    // The default scheme is a first order Euler step.
+    Engine euler;
+    EXPECT_EQ(physics::IntegratorType::SymplecticEuler, euler.GetIntegrator());
+}
+
+TEST_F(EngineLoopTest, StillParticlesSleepAndWake) {
+    SleepSettings settings;
+    settings.ticks = 5;
+    mEngine.EnableSleeping(settings);
+
+    physics::Particle moving;
+    moving.SetVelocity(math::Vector(1.0f, 0.0f, 0.0f));
+    const auto moving_handle = mEngine.AddParticle(moving);
+    std::vector<physics::ParticleHandle> moored;
+    for (int i = 0; i < 10; ++i) {
+        moored.push_back(mEngine.AddParticle(physics::Particle()));
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        mEngine.UpdateParticles(0.1);
+    }
+    EXPECT_EQ(11u, mEngine.GetAwakeParticleCount());
+    mEngine.UpdateParticles(0.1);
+    EXPECT_EQ(1u, mEngine.GetAwakeParticleCount());
+
+    // Sleepers are skipped but the moving particle keeps going.
+    auto& particles = mEngine.GetParticles();
+    mEngine.UpdateParticles(0.1);
+    EXPECT_NEAR(0.6, particles[particles.IndexOf(moving_handle)]
+                         .GetPosition()
+                         .GetX(),
+                1e-5);
+
+    mEngine.SetParticleVelocity(moored[3], math::Vector(0.0f, 2.0f, 0.0f));
+    EXPECT_EQ(2u, mEngine.GetAwakeParticleCount());
+    mEngine.UpdateParticles(0.1);
+    EXPECT_NEAR(0.2, particles[particles.IndexOf(moored[3])]
+                         .GetPosition()
+                         .GetY(),
+                1e-5);
+
+    // Setting a sleeper's velocity through a proxy wakes it next tick,
+    // leaving the proxy on its entry meanwhile.
+    auto proxy = particles.Find(moored[5]);
+    ASSERT_TRUE(proxy.has_value());
+    proxy->SetVelocity(math::Vector(0.0f, 0.0f, 3.0f));
+    EXPECT_FLOAT_EQ(3.0f, proxy->GetVelocity().GetZ());
+    EXPECT_EQ(2u, mEngine.GetAwakeParticleCount());
+    mEngine.UpdateParticles(0.1);
+    EXPECT_EQ(3u, mEngine.GetAwakeParticleCount());
+    EXPECT_NEAR(0.3, particles[particles.IndexOf(moored[5])]
+                         .GetPosition()
+                         .GetZ(),
+                1e-5);
+
+    // A force that reaches the sleepers wakes them all.
+    mEngine.AddForceGenerator(
+        physics::ForceGenerator::Gravity(math::Vector(0.0f, 0.0f, -1.0f)));
+    EXPECT_EQ(11u, mEngine.GetAwakeParticleCount());
+}
+
+TEST_F(EngineLoopTest, ForceGeneratorsApplyPerTick) {
+    const auto gravity = mEngine.AddForceGenerator(
+        physics::ForceGenerator::Gravity(math::Vector(0.0f, 0.0f, -10.0f)));
+    const auto handle = mEngine.AddParticle(physics::Particle(1.0));
+    mEngine.UpdateParticles(0.5);
+
+    auto& particles = mEngine.GetParticles();
+    const std::size_t index = particles.IndexOf(handle);
+    EXPECT_FLOAT_EQ(-5.0f, particles[index].GetVelocity().GetZ());
+    EXPECT_FLOAT_EQ(0.0f, particles[index].GetAcceleration().GetZ());
+
+    EXPECT_TRUE(mEngine.RemoveForceGenerator(gravity));
+    mEngine.UpdateParticles(0.5);
+    EXPECT_FLOAT_EQ(-5.0f, particles[index].GetVelocity().GetZ());
+}
+
+TEST_F(EngineLoopTest, SlowRateGroupsUpdateOnTheirPhase) {
+    const RateGroupId slow = mEngine.AddRateGroup(4);
+    physics::Particle particle;
+    particle.SetVelocity(math::Vector(1.0f, 0.0f, 0.0f));
+    std::vector<physics::ParticleHandle> handles;
+    for (int i = 0; i < 8; ++i) {
+        handles.push_back(mEngine.AddParticle(particle));
+        mEngine.SetParticleRateGroup(handles.back(), slow);
+    }
+    const auto fast = mEngine.AddParticle(particle);
+
+    // Members are spread over the phases, two per tick.
+    auto& particles = mEngine.GetParticles();
+    const auto moved = [&] {
+        int count = 0;
+        for (const auto handle : handles) {
+            count += particles[particles.IndexOf(handle)]
+                         .GetPosition()
+                         .GetX() > 0.0;
+        }
+        return count;
+    };
+    const auto position = [&](physics::ParticleHandle handle) {
+        return particles[particles.IndexOf(handle)].GetPosition().GetX();
+    };
+    mEngine.UpdateParticles(0.1);
+    EXPECT_EQ(2, moved());
+    mEngine.UpdateParticles(0.1);
+    EXPECT_EQ(4, moved());
+
+    // A first update covers only the time since the group was joined.
+    for (const auto handle : handles) {
+        const double x = position(handle);
+        EXPECT_TRUE(x == 0.0 || std::abs(x - 0.1) < 1e-5 ||
+                    std::abs(x - 0.2) < 1e-5)
+            << x;
+    }
+
+    // Later updates cover the ticks the member skipped, so each phase is
+    // where the clock was when it last ran.
+    for (int i = 0; i < 6; ++i) {
+        mEngine.UpdateParticles(0.1);
+    }
+    std::vector<double> positions;
+    for (const auto handle : handles) {
+        positions.push_back(position(handle));
+    }
+    std::sort(positions.begin(), positions.end());
+    const double expected[] = {0.5, 0.5, 0.6, 0.6, 0.7, 0.7, 0.8, 0.8};
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        EXPECT_NEAR(expected[i], positions[i], 1e-5);
+    }
+    EXPECT_NEAR(0.8, position(fast), 1e-5);
+
+    // Leaving the slow group catches the particle up to the clock.
+    mEngine.SetParticleRateGroup(handles[0], Engine::BASE_RATE_GROUP);
+    mEngine.UpdateParticles(0.1);
+    EXPECT_NEAR(0.9, position(handles[0]), 1e-5);
+
+    // Joining mid-cycle never moves a particle past the clock.
+    mEngine.SetParticleRateGroup(fast, slow);
+    for (int i = 0; i < 4; ++i) {
+        mEngine.UpdateParticles(0.1);
+        EXPECT_LE(position(fast), mEngine.GetSimulationTime() + 1e-5);
+    }
+    EXPECT_GT(position(fast), 0.9 + 1e-5);
+    EXPECT_THROW(mEngine.AddRateGroup(0), std::invalid_argument);
+    EXPECT_THROW(mEngine.SetParticleRateGroup(fast, 7), std::out_of_range);
+}
+
+TEST_F(EngineLoopTest, RunForRunsWholeBatches) {
+    physics::Particle particle;
+    particle.SetVelocity(math::Vector(2.0f, 0.0f, 0.0f));
+    const auto handle = mEngine.AddParticle(particle);
+
+    // As fast as possible: exactly duration / time_step ticks.
+    EXPECT_EQ(1000u, mEngine.RunFor(10.0, 0.01));
+    EXPECT_EQ(1000u, mEngine.GetTickCount());
+    EXPECT_FALSE(mEngine.IsRunning());
+    auto& particles = mEngine.GetParticles();
+    EXPECT_NEAR(20.0,
+                particles[particles.IndexOf(handle)].GetPosition().GetX(),
+                1e-3);
+
+    // The callback sees every tick and can end the run early.
+    RunOptions options;
+    std::uint64_t last_tick = 0;
+    options.on_tick = [&last_tick](std::uint64_t tick, double time) {
+        last_tick = tick;
+        EXPECT_NEAR(static_cast<double>(tick) * 0.01, time, 1e-9);
+        return tick < 1010;
+    };
+    EXPECT_EQ(10u, mEngine.RunFor(10.0, 0.01, options));
+    EXPECT_EQ(1010u, last_tick);
+
+    // A time scale paces the ticks: 0.2 simulated seconds at 10x.
+    const auto start = std::chrono::steady_clock::now();
+    options = {};
+    options.time_scale = 10.0;
+    EXPECT_EQ(20u, mEngine.RunFor(0.2, 0.01, options));
+    EXPECT_GE(std::chrono::steady_clock::now() - start,
+              std::chrono::milliseconds(18));
+
+    EXPECT_THROW(mEngine.RunFor(1.0, 0.0), std::invalid_argument);
+}
+
+TEST_F(EngineLoopTest, RunForStopsWhenACallbackThrows) {
+    mEngine.AddWorld();
+    mEngine.AddParticle(physics::Particle());
+
+    RunOptions options;
+    options.on_tick = [](std::uint64_t tick, double) {
+        if (tick == 3) {
+            throw std::runtime_error("callback failed");
+        }
+        return true;
+    };
+    EXPECT_THROW(mEngine.RunFor(1.0, 0.01, options), std::runtime_error);
+    EXPECT_EQ(3u, mEngine.GetTickCount());
+
+    // The engine is stopped: commands apply at once and batches run again.
+    EXPECT_FALSE(mEngine.IsRunning());
+    mEngine.AddParticle(physics::Particle());
+    EXPECT_EQ(2u, mEngine.GetParticleCount());
+    EXPECT_EQ(5u, mEngine.RunFor(0.05, 0.01));
+}
+
+TEST_F(EngineLoopTest, RunForStopsWhenAWorldStageThrows) {
+    const WorldId second = mEngine.AddWorld();
+    physics::Particle particle;
+    particle.SetRadius(1.0f);
+    mEngine.AddParticle(second, particle);
+    mEngine.AddParticle(second, particle);
+
+    int calls = 0;
+    mEngine.EnableBroadPhase(
+        second, [&calls](const std::vector<physics::CollisionPair>&) {
+            if (++calls == 3) {
+                throw std::runtime_error("collision callback failed");
+            }
+        });
+    EXPECT_THROW(mEngine.RunFor(1.0, 0.01), std::runtime_error);
+    EXPECT_EQ(3, calls);
+    EXPECT_FALSE(mEngine.IsRunning());
+
+    // The failure is not reported again by the next batch.
+    mEngine.EnableBroadPhase(second, {});
+    EXPECT_EQ(5u, mEngine.RunFor(0.05, 0.01));
+}
+
+void ThrowingObserver(int& calls, const TickView& view) {
+    ++calls;
+    if (view.tick == 3) {
+        throw std::runtime_error("observer failed");
+    }
+}
+
+TEST_F(EngineLoopTest, RunForStopsWhenAWorkerObserverThrows) {
+    mEngine.AddParticle(physics::Particle());
+
+    int calls = 0;
+    TickObserver observer = MakeTickObserver<&ThrowingObserver>(calls);
+    observer.thread = ObserverThread::Worker;
+    mEngine.AddObserver(observer);
+
+    RunOptions options;
+    options.threads.thread_count = 2;
+    EXPECT_THROW(mEngine.RunFor(1.0, 0.01, options), std::runtime_error);
+    EXPECT_EQ(3u, mEngine.GetTickCount());
+    EXPECT_EQ(3, calls);
+    EXPECT_FALSE(mEngine.IsRunning());
+}
+
+TEST_F(EngineLoopTest, StopRethrowsWhatEndedTheLoop) {
+    mEngine.AddParticle(physics::Particle());
+
+    int calls = 0;
+    mEngine.AddObserver(MakeTickObserver<&ThrowingObserver>(calls));
+    mEngine.Start(1000.0);
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (mEngine.IsRunning() &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_FALSE(mEngine.IsRunning());
+    EXPECT_EQ(3u, mEngine.GetTickCount());
+
+    // The loop is gone but not torn down until Stop() reports why.
+    EXPECT_THROW(mEngine.Start(1000.0), std::logic_error);
+    EXPECT_THROW(mEngine.RunFor(0.01, 0.01), std::logic_error);
+    EXPECT_THROW(mEngine.Stop(), std::runtime_error);
+    EXPECT_NO_THROW(mEngine.Stop());
+
+    mEngine.AddParticle(physics::Particle());
+    EXPECT_EQ(2u, mEngine.GetParticleCount());
+    EXPECT_EQ(1u, mEngine.RunFor(0.01, 0.01));
+}
+
+TEST_F(EngineLoopTest, StartOptionsPlaceThreads) {
+    physics::Particle particle;
+    particle.SetVelocity(math::Vector(1.0f, 0.0f, 0.0f));
+    for (int i = 0; i < 1000; ++i) {
+        mEngine.AddParticle(particle);
+    }
+
+    // An unknown CPU cannot be applied; the thread runs unplaced.
+    StartOptions options;
+    options.thread_count = 2;
+    options.worker_threads.resize(1);
+    options.worker_threads[0].cpus = {1u << 20};
+    options.first_touch = true;
+    mEngine.Start(200.0, options);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    mEngine.Stop();
+
+    EXPECT_EQ(1u, mEngine.GetStats().placement_failures);
+    auto& particles = mEngine.GetParticles();
+    const double expected = mEngine.GetSimulationTime();
+    ASSERT_GT(expected, 0.0);
+    for (std::size_t i = 0; i < particles.size(); ++i) {
+        ASSERT_NEAR(expected, particles[i].GetPosition().GetX(), 1e-4);
+    }
+}
+
+struct TickRecorder {
+    std::vector<std::uint64_t> ticks;
+    std::vector<double> positions;
+
+    void Record(const TickView& view) {
+        ticks.push_back(view.tick);
+        positions.push_back(view.particles->Position().x[0]);
+    }
+};
+
+void SlowObserver(int& calls, const TickView& /*view*/) {
+    ++calls;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+TEST_F(EngineLoopTest, ObserversSeeEveryTick) {
+    physics::Particle particle;
+    particle.SetVelocity(math::Vector(1.0f, 0.0f, 0.0f));
+    mEngine.AddParticle(particle);
+
+    TickRecorder recorder;
+    const ObserverId recorder_id = mEngine.AddObserver(
+        MakeTickObserver<&TickRecorder::Record>(recorder));
+
+    int slow_calls = 0;
+    TickObserver slow = MakeTickObserver<&SlowObserver>(slow_calls);
+    slow.thread = ObserverThread::Worker;
+    slow.budget = 1;
+    const ObserverId slow_id = mEngine.AddObserver(slow);
+
+    RunOptions options;
+    options.threads.thread_count = 2;
+    ASSERT_EQ(4u, mEngine.RunFor(1.0, 0.25, options));
+
+    ASSERT_EQ(4u, recorder.ticks.size());
+    for (std::size_t i = 0; i < recorder.ticks.size(); ++i) {
+        EXPECT_EQ(i + 1, recorder.ticks[i]);
+        EXPECT_DOUBLE_EQ(0.25 * static_cast<double>(i + 1),
+                         recorder.positions[i]);
+    }
+    EXPECT_EQ(4, slow_calls);
+    EXPECT_EQ(0u, mEngine.GetObserverOverruns(recorder_id));
+    EXPECT_EQ(4u, mEngine.GetObserverOverruns(slow_id));
+    EXPECT_EQ(4u, mEngine.GetStats().observer_overruns);
+
+    EXPECT_TRUE(mEngine.RemoveObserver(slow_id));
+    EXPECT_FALSE(mEngine.RemoveObserver(slow_id));
+    EXPECT_THROW(mEngine.GetObserverOverruns(slow_id), std::out_of_range);
+    mEngine.UpdateParticles(0.25);
+    EXPECT_EQ(5u, recorder.ticks.size());
+    EXPECT_EQ(4, slow_calls);
+
+    TickObserver unbound;
+    EXPECT_THROW(mEngine.AddObserver(unbound), std::invalid_argument);
+}
+
 } // namespace test
 } // namespace engine
 } // namespace solo
@@ -0,0 +1,92 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/FixedStepScheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+namespace {
+
+using solo::engine::FixedStepScheduler;
+using std::chrono::milliseconds;
+
+TEST(fixed_step_scheduler_test, first_deadline_is_due_immediately) {
+    FixedStepScheduler scheduler;
+    const auto start = FixedStepScheduler::Clock::now();
+    scheduler.Reset(100.0, start);
+
+    EXPECT_DOUBLE_EQ(0.01, scheduler.GetTimeStep());
+    EXPECT_EQ(1u, scheduler.Advance(start));
+    EXPECT_EQ(0u, scheduler.Advance(start + milliseconds(5)));
+    EXPECT_EQ(start + milliseconds(10), scheduler.GetNextDeadline());
+}
+
+TEST(fixed_step_scheduler_test, deadlines_do_not_drift_with_late_wakeups) {
+    FixedStepScheduler scheduler;
+    const auto start = FixedStepScheduler::Clock::now();
+    scheduler.Reset(100.0, start);
+    scheduler.Advance(start);
+
+    // Waking 3 ms late every tick must not push later deadlines back.
+    for (int tick = 1; tick <= 1000; ++tick) {
+        const auto wake = start + milliseconds(10 * tick + 3);
+        ASSERT_EQ(1u, scheduler.Advance(wake));
+    }
+    EXPECT_EQ(start + milliseconds(10010), scheduler.GetNextDeadline());
+    EXPECT_EQ(0u, scheduler.GetStats().missed_deadlines);
+}
+
+TEST(fixed_step_scheduler_test, overrun_runs_catch_up_ticks) {
+    FixedStepScheduler scheduler(5);
+    const auto start = FixedStepScheduler::Clock::now();
+    scheduler.Reset(100.0, start);
+    scheduler.Advance(start);
+
+    // A 35 ms stall leaves the deadlines at 10, 20 and 30 ms outstanding.
+    EXPECT_EQ(3u, scheduler.Advance(start + milliseconds(35)));
+    EXPECT_EQ(start + milliseconds(40), scheduler.GetNextDeadline());
+
+    const auto stats = scheduler.GetStats();
+    EXPECT_EQ(4u, stats.ticks);
+    EXPECT_EQ(2u, stats.missed_deadlines);
+    EXPECT_EQ(2u, stats.catch_up_ticks);
+    EXPECT_EQ(0u, stats.dropped_ticks);
+}
+
+TEST(fixed_step_scheduler_test, catch_up_is_limited) {
+    FixedStepScheduler scheduler(3);
+    const auto start = FixedStepScheduler::Clock::now();
+    scheduler.Reset(100.0, start);
+    scheduler.Advance(start);
+
+    EXPECT_EQ(3u, scheduler.Advance(start + milliseconds(105)));
+    EXPECT_EQ(start + milliseconds(110), scheduler.GetNextDeadline());
+
+    const auto stats = scheduler.GetStats();
+    EXPECT_EQ(9u, stats.missed_deadlines);
+    EXPECT_EQ(2u, stats.catch_up_ticks);
+    EXPECT_EQ(7u, stats.dropped_ticks);
+}
+
+TEST(fixed_step_scheduler_test, wait_returns_at_deadline) {
+    FixedStepScheduler scheduler;
+    const auto start = FixedStepScheduler::Clock::now();
+    scheduler.Reset(200.0, start);
+    scheduler.Advance(start);
+
+    scheduler.WaitForNextDeadline();
+    EXPECT_GE(FixedStepScheduler::Clock::now(), start + milliseconds(5));
+    EXPECT_GE(scheduler.Advance(FixedStepScheduler::Clock::now()), 1u);
+}
+
+}  // namespace
@@ -0,0 +1,73 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/LatencyHistogram.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+using solo::engine::LatencyHistogram;
+
+TEST(latency_histogram_test, buckets_resolve_values_closely) {
+    for (std::uint64_t value : {0ull, 1ull, 127ull, 128ull, 1000ull,
+                                16'666'667ull, 1ull << 40, ~0ull}) {
+        const std::size_t index = LatencyHistogram::BucketIndex(value);
+        const std::uint64_t upper = LatencyHistogram::BucketUpperBound(index);
+        EXPECT_GE(upper, value);
+        EXPECT_LE(upper - value, value / 64) << value;
+        if (index > 0) {
+            EXPECT_LT(LatencyHistogram::BucketUpperBound(index - 1), value);
+        }
+    }
+}
+
+TEST(latency_histogram_test, empty_summary_is_zero) {
+    LatencyHistogram histogram;
+    const auto summary = histogram.Summarize();
+    EXPECT_EQ(0u, summary.count);
+    EXPECT_EQ(0u, summary.p50);
+    EXPECT_EQ(0u, summary.max);
+}
+
+TEST(latency_histogram_test, percentiles_of_uniform_distribution) {
+    LatencyHistogram histogram;
+    for (std::uint64_t value = 1; value <= 10000; ++value) {
+        histogram.Record(value * 1000);
+    }
+
+    const auto summary = histogram.Summarize();
+    EXPECT_EQ(10000u, summary.count);
+    EXPECT_EQ(5'000'500u, summary.mean);
+    EXPECT_NEAR(5'000'000.0, static_cast<double>(summary.p50), 5'000'000.0 / 64);
+    EXPECT_NEAR(9'900'000.0, static_cast<double>(summary.p99), 9'900'000.0 / 64);
+    EXPECT_NEAR(9'990'000.0, static_cast<double>(summary.p999),
+                9'990'000.0 / 64);
+    EXPECT_EQ(10'000'000u, summary.max);
+}
+
+TEST(latency_histogram_test, tail_outlier_shows_in_max_only) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 2000; ++i) {
+        histogram.Record(100);
+    }
+    histogram.Record(50'000'000);
+
+    const auto summary = histogram.Summarize();
+    EXPECT_EQ(100u, summary.p50);
+    EXPECT_EQ(100u, summary.p999);
+    EXPECT_EQ(50'000'000u, summary.max);
+}
+
+}  // namespace
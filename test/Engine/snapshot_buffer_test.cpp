@@ -0,0 +1,164 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/SnapshotBuffer.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Engine/Engine.h"
+#include "Math/Vector.h"
+#include "Particle/Particle.h"
+#include "Particle/ParticleStore.h"
+
+namespace {
+
+using solo::engine::ParticleSnapshot;
+using solo::engine::PinnedSnapshot;
+using solo::engine::SnapshotBuffer;
+
+void Publish(SnapshotBuffer& buffer, solo::physics::ParticleStore& store,
+             std::uint64_t tick) {
+    for (std::size_t i = 0; i < store.size(); ++i) {
+        store.Position().x[i] = static_cast<double>(tick);
+    }
+    ParticleSnapshot* snapshot = buffer.BeginWrite();
+    if (snapshot == nullptr) {
+        return;
+    }
+    snapshot->Resize(store.size());
+    snapshot->CopyRange(store, 0, store.size());
+    snapshot->SetTick(tick, static_cast<double>(tick) * 0.5);
+    buffer.CommitWrite();
+}
+
+solo::physics::ParticleStore MakeStore(std::size_t count) {
+    solo::physics::ParticleStore store;
+    for (std::size_t i = 0; i < count; ++i) {
+        store.Add(solo::physics::Particle());
+    }
+    return store;
+}
+
+TEST(snapshot_buffer_test, empty_before_first_publish) {
+    const SnapshotBuffer buffer;
+    EXPECT_FALSE(buffer.Acquire());
+}
+
+TEST(snapshot_buffer_test, acquire_returns_latest) {
+    SnapshotBuffer buffer;
+    solo::physics::ParticleStore store = MakeStore(4);
+
+    Publish(buffer, store, 1);
+    Publish(buffer, store, 2);
+
+    const PinnedSnapshot snapshot = buffer.Acquire();
+    ASSERT_TRUE(snapshot);
+    EXPECT_EQ(2u, snapshot->GetTick());
+    EXPECT_DOUBLE_EQ(1.0, snapshot->GetSimulationTime());
+    ASSERT_EQ(4u, snapshot->size());
+    EXPECT_DOUBLE_EQ(2.0, snapshot->Position().x[3]);
+}
+
+TEST(snapshot_buffer_test, pinned_snapshot_is_not_overwritten) {
+    SnapshotBuffer buffer(3);
+    solo::physics::ParticleStore store = MakeStore(2);
+
+    Publish(buffer, store, 1);
+    const PinnedSnapshot held = buffer.Acquire();
+
+    for (std::uint64_t tick = 2; tick < 50; ++tick) {
+        Publish(buffer, store, tick);
+    }
+
+    EXPECT_EQ(1u, held->GetTick());
+    EXPECT_DOUBLE_EQ(1.0, held->Position().x[0]);
+    EXPECT_EQ(49u, buffer.Acquire()->GetTick());
+    EXPECT_EQ(0u, buffer.GetSkippedWrites());
+}
+
+TEST(snapshot_buffer_test, skips_publish_when_all_slots_pinned) {
+    SnapshotBuffer buffer(3);
+    solo::physics::ParticleStore store = MakeStore(1);
+
+    Publish(buffer, store, 1);
+    const PinnedSnapshot first = buffer.Acquire();
+    Publish(buffer, store, 2);
+    const PinnedSnapshot second = buffer.Acquire();
+    Publish(buffer, store, 3);
+    const PinnedSnapshot third = buffer.Acquire();
+
+    Publish(buffer, store, 4);
+    EXPECT_EQ(1u, buffer.GetSkippedWrites());
+    EXPECT_EQ(3u, buffer.Acquire()->GetTick());
+}
+
+TEST(snapshot_buffer_test, concurrent_readers_see_consistent_ticks) {
+    SnapshotBuffer buffer(5);
+    solo::physics::ParticleStore store = MakeStore(256);
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+
+    auto reader = [&buffer, &done, &torn]() {
+        while (!done.load()) {
+            const PinnedSnapshot snapshot = buffer.Acquire();
+            if (!snapshot) {
+                continue;
+            }
+            for (std::size_t i = 0; i < snapshot->size(); ++i) {
+                const auto written =
+                    static_cast<std::uint64_t>(snapshot->Position().x[i]);
+                if (written != snapshot->GetTick()) {
+                    torn.fetch_add(1);
+                }
+            }
+        }
+    };
+
+    std::thread first(reader);
+    std::thread second(reader);
+    for (std::uint64_t tick = 1; tick < 5000; ++tick) {
+        Publish(buffer, store, tick);
+    }
+    done = true;
+    first.join();
+    second.join();
+
+    EXPECT_EQ(0, torn.load());
+}
+
+TEST(snapshot_buffer_test, engine_publishes_after_each_tick) {
+    solo::engine::Engine engine;
+    EXPECT_FALSE(engine.AcquireSnapshot());
+
+    solo::physics::Particle particle;
+    particle.SetVelocity(solo::math::Vector(2.0f, 0.0f, 0.0f));
+    engine.AddParticle(particle);
+    engine.EnableSnapshots();
+
+    engine.UpdateParticles(0.5);
+    engine.UpdateParticles(0.5);
+
+    const PinnedSnapshot snapshot = engine.AcquireSnapshot();
+    ASSERT_TRUE(snapshot);
+    EXPECT_EQ(2u, snapshot->GetTick());
+    EXPECT_EQ(2u, engine.GetTickCount());
+    EXPECT_DOUBLE_EQ(1.0, snapshot->GetSimulationTime());
+    EXPECT_DOUBLE_EQ(2.0, snapshot->Position().x[0]);
+}
+
+}  // namespace
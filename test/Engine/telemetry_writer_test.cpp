@@ -0,0 +1,210 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/TelemetryWriter.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Engine/Engine.h"
+#include "Math/Vector.h"
+#include "Particle/Particle.h"
+
+namespace {
+
+using solo::engine::Engine;
+using solo::engine::TelemetryFormat;
+using solo::engine::TelemetryOverflow;
+using solo::engine::TelemetryParticle;
+using solo::engine::TelemetrySettings;
+using solo::engine::TelemetryTick;
+using solo::engine::TelemetryWriter;
+
+class TelemetryWriterTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mPath = std::filesystem::temp_directory_path() /
+                ("solo_telemetry_" +
+                 std::string(::testing::UnitTest::GetInstance()
+                                 ->current_test_info()
+                                 ->name()) +
+                 ".out");
+        for (int i = 0; i < 3; ++i) {
+            solo::physics::Particle particle;
+            particle.SetVelocity(
+                solo::math::Vector(static_cast<float>(i + 1), 0.0f, 0.0f));
+            mEngine.AddParticle(particle);
+        }
+    }
+
+    void TearDown() override { std::filesystem::remove(mPath); }
+
+    std::string ReadFile() const {
+        std::ifstream file(mPath, std::ios::binary);
+        return {std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>()};
+    }
+
+    std::filesystem::path mPath;
+    Engine mEngine;
+};
+
+TEST_F(TelemetryWriterTest, BinaryFileHoldsEveryTick) {
+    TelemetrySettings settings;
+    settings.overflow = TelemetryOverflow::Block;
+    TelemetryWriter writer(mPath, settings);
+    mEngine.AddObserver(writer.GetObserver());
+    ASSERT_EQ(4u, mEngine.RunFor(1.0, 0.25));
+    writer.Close();
+    EXPECT_EQ(4u, writer.GetRecordedTicks());
+
+    const std::string contents = ReadFile();
+    ASSERT_EQ(sizeof(solo::engine::TELEMETRY_MAGIC) + 4 * 4 * 32,
+              contents.size());
+    EXPECT_EQ(0, std::memcmp(solo::engine::TELEMETRY_MAGIC, contents.data(),
+                             sizeof(solo::engine::TELEMETRY_MAGIC)));
+
+    const char* record =
+        contents.data() + sizeof(solo::engine::TELEMETRY_MAGIC);
+    for (std::uint64_t tick = 1; tick <= 4; ++tick) {
+        TelemetryTick header;
+        std::memcpy(&header, record, sizeof(header));
+        record += sizeof(header);
+        EXPECT_EQ(tick, header.tick);
+        EXPECT_DOUBLE_EQ(0.25 * static_cast<double>(tick),
+                         header.simulation_time);
+        ASSERT_EQ(3u, header.particle_count);
+
+        for (std::uint32_t i = 0; i < 3; ++i) {
+            TelemetryParticle particle;
+            std::memcpy(&particle, record, sizeof(particle));
+            record += sizeof(particle);
+            EXPECT_EQ(i, particle.handle.index);
+            EXPECT_DOUBLE_EQ(header.simulation_time * (i + 1), particle.x);
+        }
+    }
+}
+
+TEST_F(TelemetryWriterTest, CsvHasALinePerParticlePerTick) {
+    TelemetrySettings settings;
+    settings.format = TelemetryFormat::Csv;
+    settings.batch_bytes = 64;
+    {
+        TelemetryWriter writer(mPath, settings);
+        const auto id = mEngine.AddObserver(writer.GetObserver());
+        mEngine.UpdateParticles(0.5);
+        mEngine.UpdateParticles(0.5);
+        mEngine.RemoveObserver(id);
+    }
+
+    EXPECT_EQ(
+        "tick,time,index,generation,x,y,z\n"
+        "1,0.5,0,0,0.5,0,0\n"
+        "1,0.5,1,0,1,0,0\n"
+        "1,0.5,2,0,1.5,0,0\n"
+        "2,1,0,0,1,0,0\n"
+        "2,1,1,0,2,0,0\n"
+        "2,1,2,0,3,0,0\n",
+        ReadFile());
+}
+
+TEST_F(TelemetryWriterTest, OverflowPolicyDropsOrBlocks) {
+    // Each tick needs four records; the ring holds two, so dropping would
+    // lose every tick.
+    TelemetrySettings settings;
+    settings.ring_capacity = 2;
+    {
+        TelemetryWriter writer(mPath, settings);
+        const auto id = mEngine.AddObserver(writer.GetObserver());
+        mEngine.UpdateParticles(0.5);
+        mEngine.RemoveObserver(id);
+        EXPECT_EQ(0u, writer.GetRecordedTicks());
+        EXPECT_EQ(1u, writer.GetDroppedTicks());
+        EXPECT_EQ(1u, writer.GetOversizedTicks());
+        EXPECT_THROW(writer.Close(), std::runtime_error);
+    }
+    EXPECT_EQ(sizeof(solo::engine::TELEMETRY_MAGIC), ReadFile().size());
+
+    // Blocking streams each tick through as the writer makes room.
+    settings.overflow = TelemetryOverflow::Block;
+    {
+        TelemetryWriter writer(mPath, settings);
+        const auto id = mEngine.AddObserver(writer.GetObserver());
+        mEngine.UpdateParticles(0.5);
+        mEngine.UpdateParticles(0.5);
+        mEngine.RemoveObserver(id);
+        EXPECT_EQ(2u, writer.GetRecordedTicks());
+        EXPECT_EQ(0u, writer.GetDroppedTicks());
+        EXPECT_EQ(0u, writer.GetOversizedTicks());
+    }
+    EXPECT_EQ(sizeof(solo::engine::TELEMETRY_MAGIC) + 2 * 4 * 32,
+              ReadFile().size());
+}
+
+TEST_F(TelemetryWriterTest, CloseReportsAFailedWrite) {
+    // Every write to /dev/full fails with no space left.
+    const std::filesystem::path full("/dev/full");
+    if (!std::filesystem::exists(full)) {
+        GTEST_SKIP() << "/dev/full is not available";
+    }
+    TelemetryWriter writer(full);
+    mEngine.AddObserver(writer.GetObserver());
+    mEngine.UpdateParticles(0.5);
+    EXPECT_THROW(writer.Close(), std::runtime_error);
+    EXPECT_NO_THROW(writer.Close());
+}
+
+TEST_F(TelemetryWriterTest, CloseWhileRunningKeepsWholeTicks) {
+    // Each tick takes many times the ring, so a close lands mid-tick.
+    for (int i = 0; i < 200; ++i) {
+        mEngine.AddParticle(solo::physics::Particle());
+    }
+    TelemetrySettings settings;
+    settings.overflow = TelemetryOverflow::Block;
+    settings.ring_capacity = 16;
+    TelemetryWriter writer(mPath, settings);
+    mEngine.AddObserver(writer.GetObserver());
+
+    mEngine.Start(1000.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    writer.Close();
+    mEngine.Stop();
+    EXPECT_GT(writer.GetRecordedTicks(), 0u);
+
+    // The file ends on a tick boundary and holds every recorded tick.
+    const std::string contents = ReadFile();
+    std::size_t offset = sizeof(solo::engine::TELEMETRY_MAGIC);
+    std::uint64_t ticks = 0;
+    while (offset < contents.size()) {
+        TelemetryTick header;
+        ASSERT_LE(offset + sizeof(header), contents.size());
+        std::memcpy(&header, contents.data() + offset, sizeof(header));
+        EXPECT_EQ(203u, header.particle_count);
+        offset += sizeof(header) +
+                  header.particle_count * sizeof(TelemetryParticle);
+        ++ticks;
+    }
+    EXPECT_EQ(contents.size(), offset);
+    EXPECT_EQ(writer.GetRecordedTicks(), ticks);
+}
+
+}  // namespace
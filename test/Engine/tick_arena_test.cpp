@@ -0,0 +1,158 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/TickArena.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Engine/Engine.h"
+#include "Engine/TickObserver.h"
+#include "Particle/Particle.h"
+#include "Physics/ForceRegistry.h"
+
+namespace {
+
+// Calls to the global operator new, counted across the whole test binary.
+std::atomic<std::uint64_t> g_heap_calls{0};
+
+}  // namespace
+
+void* operator new(std::size_t bytes) {
+    g_heap_calls.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(bytes == 0 ? 1 : bytes)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::size_t /*bytes*/) noexcept {
+    std::free(pointer);
+}
+
+namespace {
+
+using solo::engine::TickArena;
+
+/// @brief Upstream resource counting the allocations passed to it.
+class CountingResource : public std::pmr::memory_resource {
+   public:
+    std::size_t allocations{0};
+
+   private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* pointer, std::size_t bytes,
+                       std::size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+    bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+TEST(tick_arena_test, reset_rewinds_the_buffer) {
+    CountingResource upstream;
+    TickArena arena(1024, &upstream);
+    EXPECT_EQ(1u, upstream.allocations);
+
+    void* first = arena.GetResource()->allocate(512);
+    arena.Reset();
+    void* second = arena.GetResource()->allocate(512);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1u, upstream.allocations);
+}
+
+TEST(tick_arena_test, overflow_grows_the_buffer) {
+    CountingResource upstream;
+    TickArena arena(256, &upstream);
+
+    // The first tick outgrows the buffer and borrows from upstream.
+    EXPECT_NE(nullptr, arena.GetResource()->allocate(1024));
+    EXPECT_LT(1u, upstream.allocations);
+    arena.Reset();
+    EXPECT_LE(256u + 1024u, arena.GetCapacity());
+
+    // Later ticks of the same size fit.
+    const std::size_t allocations = upstream.allocations;
+    for (int tick = 0; tick < 3; ++tick) {
+        EXPECT_NE(nullptr, arena.GetResource()->allocate(1024));
+        arena.Reset();
+    }
+    EXPECT_EQ(allocations, upstream.allocations);
+}
+
+/// @brief Loop observer building a scratch list every tick.
+struct FarParticles {
+    std::size_t count{0};
+
+    void Record(const solo::engine::TickView& view) {
+        std::pmr::vector<std::size_t> far(view.memory);
+        const auto& position = view.particles->Position();
+        for (std::size_t i = 0; i < position.x.size(); ++i) {
+            if (position.x[i] > 19.5) {
+                far.push_back(i);
+            }
+        }
+        count = far.size();
+    }
+};
+
+TEST(tick_arena_test, engine_ticks_without_heap_calls) {
+    solo::engine::Engine engine;
+    for (int i = 0; i < 2000; ++i) {
+        solo::physics::Particle particle(1.0);
+        particle.SetPosition(solo::math::WorldCoordinates(
+            i % 40, (i / 40) % 50, 0.01 * i));
+        particle.SetRadius(0.6f);
+        engine.AddParticle(particle);
+    }
+    engine.EnableGravity();
+    engine.EnableBroadPhase();
+    engine.EnableSpatialIndex(2.0);
+    engine.EnableSnapshots();
+    engine.EnableMortonOrder(10);
+    engine.AddForceGenerator(solo::physics::ForceGenerator::Drag(0.01f));
+
+    FarParticles observer;
+    engine.AddObserver(
+        solo::engine::MakeTickObserver<&FarParticles::Record>(observer));
+
+    // Warm up, letting every buffer and pool reach its working size. The
+    // particles barely move, so the octree keeps its shape and every
+    // buffer stays at the size it first reached.
+    for (int tick = 0; tick < 20; ++tick) {
+        engine.UpdateParticles(0.01);
+    }
+
+    const std::uint64_t before =
+        g_heap_calls.load(std::memory_order_relaxed);
+    for (int tick = 0; tick < 50; ++tick) {
+        engine.UpdateParticles(0.01);
+    }
+    EXPECT_EQ(before, g_heap_calls.load(std::memory_order_relaxed));
+    EXPECT_EQ(1000u, observer.count);
+}
+
+}  // namespace
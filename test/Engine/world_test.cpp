@@ -0,0 +1,393 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Engine/World.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Engine/Command.h"
+#include "Coordinates/WorldCoordinates.h"
+#include "Engine/Engine.h"
+#include "Math/Vector.h"
+#include "Particle/Particle.h"
+#include "Particle/ParticleHandle.h"
+#include "Physics/EmitterRegistry.h"
+#include "Physics/ForceRegistry.h"
+#include "Physics/Integrators.h"
+#include "Physics/Morton.h"
+#include "Threading/ThreadPool.h"
+
+namespace {
+
+using solo::engine::Command;
+using solo::engine::CommandType;
+using solo::engine::Engine;
+using solo::engine::World;
+using solo::engine::WorldId;
+
+solo::physics::Particle MovingParticle(float speed) {
+    solo::physics::Particle particle;
+    particle.SetVelocity(solo::math::Vector(speed, 0.0f, 0.0f));
+    return particle;
+}
+
+TEST(world_test, commands_and_steps) {
+    World world;
+    Command command;
+    command.type = CommandType::AddParticle;
+    command.handle = world.GetParticles().ReserveHandle();
+    command.particle = MovingParticle(2.0f);
+    world.ApplyCommand(command);
+
+    world.Step(0.5, 0);
+    ASSERT_EQ(1u, world.GetParticleCount());
+    EXPECT_DOUBLE_EQ(1.0, world.GetParticles()[0].GetPosition().GetX());
+
+    command.type = CommandType::RemoveParticle;
+    world.ApplyCommand(command);
+    EXPECT_EQ(0u, world.GetParticleCount());
+}
+
+TEST(world_test, engine_steps_worlds_together) {
+    Engine engine;
+    const WorldId second = engine.AddWorld();
+    EXPECT_EQ(2u, engine.GetWorldCount());
+
+    const auto first_handle = engine.AddParticle(MovingParticle(1.0f));
+    const auto second_handle =
+        engine.AddParticle(second, MovingParticle(3.0f));
+    engine.UpdateParticles(0.5);
+
+    auto& first_store = engine.GetParticles();
+    auto& second_store = engine.GetWorld(second).GetParticles();
+    EXPECT_DOUBLE_EQ(0.5, first_store[first_store.IndexOf(first_handle)]
+                              .GetPosition()
+                              .GetX());
+    EXPECT_DOUBLE_EQ(1.5, second_store[second_store.IndexOf(second_handle)]
+                              .GetPosition()
+                              .GetX());
+    EXPECT_THROW(engine.GetWorld(7), std::out_of_range);
+}
+
+TEST(world_test, engine_configures_each_world) {
+    Engine engine;
+    const WorldId second = engine.AddWorld();
+
+    const auto group = engine.AddRateGroup(second, 4);
+    EXPECT_EQ(2u, engine.GetWorld(second).GetRateGroupCount());
+    EXPECT_EQ(1u, engine.GetWorld(Engine::DEFAULT_WORLD).GetRateGroupCount());
+    const auto handle = engine.AddParticle(second, MovingParticle(1.0f));
+    engine.SetParticleRateGroup(second, handle, group);
+
+    solo::physics::Emitter emitter;
+    emitter.lifetime = 10.0;
+    const auto emitter_id = engine.AddEmitter(second, emitter);
+    engine.EmitBurst(second, emitter_id, 5);
+    engine.EnableSpatialIndex(second, 2.0);
+    engine.UpdateParticles(0.5);
+    EXPECT_EQ(6u, engine.GetWorld(second).GetParticleCount());
+    EXPECT_EQ(0u, engine.GetParticleCount());
+    EXPECT_NE(nullptr, engine.GetWorld(second).GetSpatialIndex());
+    EXPECT_EQ(nullptr, engine.GetSpatialIndex());
+
+    EXPECT_THROW(engine.AddRateGroup(7, 2), std::out_of_range);
+    EXPECT_THROW(engine.EmitBurst(7, emitter_id, 1), std::out_of_range);
+
+    // The world overloads are refused while running, like the others.
+    engine.Start(100.0);
+    EXPECT_THROW(engine.AddRateGroup(second, 2), std::logic_error);
+    EXPECT_THROW(engine.EnableBroadPhase(second, {}), std::logic_error);
+    EXPECT_THROW(engine.AddEmitter(second, emitter), std::logic_error);
+    engine.Stop();
+}
+
+TEST(world_test, particles_migrate_between_ticks) {
+    Engine engine;
+    const WorldId second = engine.AddWorld();
+    const auto handle = engine.AddParticle(MovingParticle(2.0f));
+    engine.UpdateParticles(0.5);
+
+    const auto moved = engine.MigrateParticle(Engine::DEFAULT_WORLD, handle,
+                                              second);
+    EXPECT_EQ(0u, engine.GetParticleCount());
+    auto& store = engine.GetWorld(second).GetParticles();
+    ASSERT_TRUE(store.Contains(moved));
+    EXPECT_DOUBLE_EQ(1.0, store[store.IndexOf(moved)].GetPosition().GetX());
+
+    // The migrated particle keeps its velocity in the new world.
+    engine.UpdateParticles(0.5);
+    EXPECT_DOUBLE_EQ(2.0, store[store.IndexOf(moved)].GetPosition().GetX());
+
+    // A stale source drops the migration; its reserved slot is reused
+    // without the returned handle ever becoming valid.
+    const auto dropped = engine.MigrateParticle(Engine::DEFAULT_WORLD,
+                                                handle, second);
+    EXPECT_FALSE(store.Contains(dropped));
+    const auto reused = engine.AddParticle(second, MovingParticle(1.0f));
+    EXPECT_EQ(dropped.index, reused.index);
+    EXPECT_FALSE(store.Contains(dropped));
+    EXPECT_EQ(2u, store.size());
+}
+
+TEST(world_test, running_worlds_stay_in_lockstep) {
+    Engine engine;
+    const WorldId second = engine.AddWorld();
+    const WorldId third = engine.AddWorld();
+    engine.AddParticle(MovingParticle(1.0f));
+    engine.AddParticle(second, MovingParticle(1.0f));
+    engine.AddParticle(third, MovingParticle(1.0f));
+
+    engine.Start(200.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    engine.Stop();
+
+    ASSERT_GT(engine.GetTickCount(), 0u);
+    const double expected = engine.GetSimulationTime();
+    EXPECT_NEAR(expected, engine.GetParticles()[0].GetPosition().GetX(),
+                1e-4);
+    EXPECT_NEAR(expected,
+                engine.GetWorld(second).GetParticles()[0].GetPosition().GetX(),
+                1e-4);
+    EXPECT_NEAR(expected,
+                engine.GetWorld(third).GetParticles()[0].GetPosition().GetX(),
+                1e-4);
+}
+
+TEST(world_test, local_frames_match_double_positions) {
+    // Steps and speeds that are exact in binary keep float offsets and
+    // double positions in agreement to the bit, across many rebases.
+    World reference;
+    World local;
+    for (int i = 0; i < 4; ++i) {
+        const double speed = 256.0 * i;
+        solo::physics::Particle particle =
+            MovingParticle(static_cast<float>(speed));
+        particle.SetPosition(
+            solo::math::WorldCoordinates(6378137.25 + 100.0 * i, 0.5, 0.0));
+        reference.GetParticles().Add(particle);
+        local.GetParticles().Add(particle);
+    }
+    local.EnableLocalFrames(64.0);
+
+    for (std::uint64_t tick = 0; tick < 200; ++tick) {
+        reference.Step(0.0625, tick);
+        local.Step(0.0625, tick);
+    }
+    local.SyncPositions();
+
+    const auto& expected = reference.GetParticles().Position();
+    const auto& actual = local.GetParticles().Position();
+    for (std::size_t i = 0; i < 4; ++i) {
+        EXPECT_DOUBLE_EQ(expected.x[i], actual.x[i]);
+        EXPECT_DOUBLE_EQ(expected.y[i], actual.y[i]);
+        EXPECT_LE(std::abs(local.GetParticles().LocalPosition().x[i]), 64.0f);
+    }
+    EXPECT_DOUBLE_EQ(6378137.25 + 300.0 + 768.0 * 200.0 / 16.0,
+                     actual.x[3]);
+}
+
+TEST(world_test, engine_syncs_local_frames_for_readers) {
+    Engine engine;
+    engine.EnableLocalFrames(16.0);
+    const auto handle = engine.AddParticle(MovingParticle(64.0f));
+    engine.UpdateParticles(0.5);
+    engine.UpdateParticles(0.5);
+
+    const auto& store = engine.GetParticles();
+    EXPECT_DOUBLE_EQ(64.0, store.Position().x[store.IndexOf(handle)]);
+
+    engine.Start(200.0);
+    EXPECT_THROW(engine.EnableLocalFrames(16.0), std::logic_error);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    engine.Stop();
+    EXPECT_NEAR(64.0 * engine.GetSimulationTime(),
+                store.Position().x[store.IndexOf(handle)], 1e-3);
+}
+
+TEST(world_test, closed_form_motion_matches_stepped_motion) {
+    // Velocity Verlet is exact under constant acceleration, so the stepped
+    // world only differs by rounding.
+    World stepped(solo::physics::IntegratorType::VelocityVerlet);
+    World closed_form;
+    for (int i = 0; i < 4; ++i) {
+        const double speed = 10.0 * i;
+        solo::physics::Particle particle =
+            MovingParticle(static_cast<float>(speed));
+        particle.SetAcceleration(solo::math::Vector(0.0f, -9.81f, 0.5f));
+        stepped.GetParticles().Add(particle);
+        closed_form.GetParticles().Add(particle);
+    }
+    closed_form.EnableClosedFormMotion();
+    EXPECT_THROW(closed_form.EnableGravity(), std::logic_error);
+    EXPECT_THROW(closed_form.EnableLocalFrames(), std::logic_error);
+
+    for (std::uint64_t tick = 0; tick < 100; ++tick) {
+        if (tick == 50) {
+            // Changing a particle restarts its closed form from now.
+            closed_form.GetParticles()[3].SetAcceleration(
+                solo::math::Vector());
+        }
+        stepped.Step(0.01, tick);
+        closed_form.Step(0.01, tick);
+    }
+    EXPECT_DOUBLE_EQ(1.0, closed_form.GetParticles().GetMotionTime());
+    closed_form.SyncPositions();
+
+    const auto& expected = stepped.GetParticles().Position();
+    const auto& actual = closed_form.GetParticles().Position();
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(expected.x[i], actual.x[i], 1e-4);
+        EXPECT_NEAR(expected.y[i], actual.y[i], 1e-4);
+        EXPECT_NEAR(expected.z[i], actual.z[i], 1e-4);
+    }
+    EXPECT_NEAR(30.0, actual.x[3], 1e-4);
+    EXPECT_NEAR(-9.81 * 0.5 * 0.5 * 0.5 - 9.81 * 0.5 * 0.5, actual.y[3],
+                1e-4);
+}
+
+TEST(world_test, engine_moves_particles_in_closed_form) {
+    Engine engine;
+    engine.EnableClosedFormMotion();
+    const auto handle = engine.AddParticle(MovingParticle(2.0f));
+    engine.UpdateParticles(0.5);
+    engine.SetParticleAcceleration(handle,
+                                   solo::math::Vector(4.0f, 0.0f, 0.0f));
+    engine.UpdateParticles(0.5);
+
+    // Direct updates leave the columns current.
+    const auto& store = engine.GetParticles();
+    const std::size_t index = store.IndexOf(handle);
+    EXPECT_DOUBLE_EQ(2.5, store.Position().x[index]);
+    EXPECT_FLOAT_EQ(4.0f, store.Velocity().x[index]);
+    EXPECT_THROW(
+        engine.AddForceGenerator(solo::physics::ForceGenerator::Drag(0.1f)),
+        std::logic_error);
+}
+
+TEST(world_test, emitted_particles_live_out_their_lifetimes) {
+    Engine engine;
+    const auto resident = engine.AddParticle(MovingParticle(1.0f));
+    solo::physics::Emitter emitter;
+    emitter.velocity = solo::math::Vector(2.0f, 0.0f, 0.0f);
+    emitter.lifetime = 0.5;
+    const auto id = engine.AddEmitter(emitter);
+
+    // The burst spawns at the start of the tick and moves with it.
+    engine.EmitBurst(id, 100);
+    engine.UpdateParticles(0.25);
+    const auto& store = engine.GetParticles();
+    ASSERT_EQ(101u, store.size());
+    for (std::size_t i = 0; i < store.size(); ++i) {
+        if (store.GetHandle(i) != resident) {
+            EXPECT_DOUBLE_EQ(0.5, store.Position().x[i]);
+        }
+    }
+
+    engine.UpdateParticles(0.25);
+    EXPECT_EQ(101u, store.size());
+    engine.UpdateParticles(0.25);
+    ASSERT_EQ(1u, store.size());
+    EXPECT_TRUE(store.Contains(resident));
+    EXPECT_DOUBLE_EQ(0.75, store.Position().x[0]);
+    EXPECT_EQ(0u, engine.GetWorld(Engine::DEFAULT_WORLD)
+                      .GetEmitters()
+                      .GetLiveCount(id));
+}
+
+TEST(world_test, morton_order_sorts_groups_in_place) {
+    World world;
+    const auto slow = world.AddRateGroup(2);
+    std::mt19937 random(7);
+    std::uniform_real_distribution<double> coordinate(-500.0, 500.0);
+    std::vector<solo::physics::ParticleHandle> handles;
+    std::vector<solo::math::WorldCoordinates> positions;
+    for (int i = 0; i < 20000; ++i) {
+        Command command;
+        command.type = CommandType::AddParticle;
+        command.handle = world.GetParticles().ReserveHandle();
+        positions.emplace_back(coordinate(random), coordinate(random),
+                               coordinate(random));
+        command.particle.SetPosition(positions.back());
+        world.ApplyCommand(command);
+        handles.push_back(command.handle);
+        if (i % 3 == 0) {
+            command.type = CommandType::SetRateGroup;
+            command.value = slow;
+            world.ApplyCommand(command);
+        }
+    }
+    auto& store = world.GetParticles();
+    for (int i = 0; i < 20000; i += 7) {
+        store.Sleep(store.IndexOf(handles[i]));
+    }
+    const std::size_t awake = store.GetAwakeCount();
+
+    EXPECT_THROW(world.EnableMortonOrder(0), std::invalid_argument);
+    world.EnableMortonOrder(4);
+    solo::threading::ThreadPool pool(2);
+    world.Step(0.5, 0, &pool);
+
+    // Particles stayed put and their handles followed them.
+    ASSERT_EQ(awake, store.GetAwakeCount());
+    for (std::size_t i = 0; i < handles.size(); ++i) {
+        const std::size_t index = store.IndexOf(handles[i]);
+        ASSERT_NE(solo::physics::ParticleStore::NPOS, index);
+        EXPECT_EQ(positions[i].GetX(), store.Position().x[index]);
+    }
+
+    // Each group and the sleeping range run along the Z-order curve of the
+    // world's padded bounding cube, at a resolution no finer than its own.
+    double low[3] = {500.0, 500.0, 500.0};
+    double high[3] = {-500.0, -500.0, -500.0};
+    for (const auto& position : positions) {
+        const double values[3] = {position.GetX(), position.GetY(),
+                                  position.GetZ()};
+        for (int axis = 0; axis < 3; ++axis) {
+            low[axis] = std::min(low[axis], values[axis]);
+            high[axis] = std::max(high[axis], values[axis]);
+        }
+    }
+    const double extent = std::max(
+        {high[0] - low[0], high[1] - low[1], high[2] - low[2]});
+    const double scale = 256.0 / (extent * (1.0 + 1.0e-9));
+    const auto code = [&](std::size_t i) {
+        return solo::physics::EncodeMorton(store.Position().x[i] - low[0],
+                                           store.Position().y[i] - low[1],
+                                           store.Position().z[i] - low[2],
+                                           scale);
+    };
+    std::size_t ordered = 0;
+    std::size_t pairs = 0;
+    for (std::uint32_t group = 0; group <= store.GetGroupCount(); ++group) {
+        const auto [first, last] =
+            group < store.GetGroupCount()
+                ? store.GetGroupRange(group)
+                : std::pair{store.GetAwakeCount(), store.size()};
+        for (std::size_t i = first; i + 1 < last; ++i) {
+            ordered += code(i) <= code(i + 1) ? 1 : 0;
+            ++pairs;
+        }
+    }
+    EXPECT_EQ(pairs, ordered);
+}
+
+}  // namespace
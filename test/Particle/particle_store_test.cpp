@@ -0,0 +1,414 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Math/Vector.h"
+#include "Particle/Particle.h"
+#include "Particle/ParticleStore.h"
+
+namespace {
+
+solo::physics::Particle MakeParticle(double mass, double x_value) {
+    solo::physics::Particle particle(mass);
+    particle.SetPosition(solo::math::WorldCoordinates(x_value, 2.0, 3.0));
+    particle.SetVelocity(solo::math::Vector(4.0f, 5.0f, 6.0f));
+    particle.SetAcceleration(solo::math::Vector(0.5f, 0.0f, -0.5f));
+    particle.SetAngle(solo::math::Vector(0.1f, 0.2f, 0.3f));
+    return particle;
+}
+
+TEST(particle_store_test, add_splits_state_into_columns) {
+    solo::physics::ParticleStore store;
+    EXPECT_TRUE(store.empty());
+
+    const auto first = store.Add(MakeParticle(2.0, 1.0));
+    const auto second = store.Add(MakeParticle(3.0, 7.0));
+    EXPECT_EQ(0u, store.IndexOf(first));
+    EXPECT_EQ(1u, store.IndexOf(second));
+
+    ASSERT_EQ(2u, store.size());
+    EXPECT_DOUBLE_EQ(3.0, store.Mass()[1]);
+    EXPECT_DOUBLE_EQ(7.0, store.Position().x[1]);
+    EXPECT_FLOAT_EQ(5.0f, store.Velocity().y[0]);
+    EXPECT_FLOAT_EQ(-0.5f, store.Acceleration().z[1]);
+    EXPECT_FLOAT_EQ(0.3f, store.Angle().z[0]);
+}
+
+TEST(particle_store_test, proxy_reads_and_writes_columns) {
+    solo::physics::ParticleStore store;
+    store.Add(MakeParticle(2.0, 1.0));
+
+    solo::physics::ParticleRef particle = store[0];
+    EXPECT_DOUBLE_EQ(2.0, particle.GetMass());
+    EXPECT_EQ(solo::math::WorldCoordinates(1.0, 2.0, 3.0),
+              particle.GetPosition());
+
+    particle.SetVelocity(solo::math::Vector(-1.0f, -2.0f, -3.0f));
+    particle.SetPosition(solo::math::WorldCoordinates(9.0, 8.0, 7.0));
+    EXPECT_FLOAT_EQ(-2.0f, store.Velocity().y[0]);
+    EXPECT_DOUBLE_EQ(7.0, store.Position().z[0]);
+
+    const solo::physics::Particle copy = store.Get(0);
+    EXPECT_EQ(solo::math::Vector(-1.0f, -2.0f, -3.0f), copy.GetVelocity());
+    EXPECT_EQ(solo::math::Vector(0.1f, 0.2f, 0.3f), copy.GetAngle());
+}
+
+TEST(particle_store_test, checked_access_and_iteration) {
+    solo::physics::ParticleStore store;
+    store.Add(MakeParticle(1.0, 1.0));
+    store.Add(MakeParticle(1.0, 2.0));
+    store.Add(MakeParticle(1.0, 3.0));
+
+    EXPECT_THROW(store.at(3), std::out_of_range);
+
+    double sum = 0.0;
+    for (const solo::physics::ParticleRef particle : store) {
+        sum += particle.GetPosition().GetX();
+    }
+    EXPECT_DOUBLE_EQ(6.0, sum);
+
+    store.Clear();
+    EXPECT_TRUE(store.empty());
+    EXPECT_TRUE(store.Position().x.empty());
+}
+
+TEST(particle_store_test, remove_swaps_last_entry_into_hole) {
+    solo::physics::ParticleStore store;
+    const auto first = store.Add(MakeParticle(1.0, 1.0));
+    const auto second = store.Add(MakeParticle(1.0, 2.0));
+    const auto third = store.Add(MakeParticle(1.0, 3.0));
+
+    EXPECT_TRUE(store.Remove(first));
+    ASSERT_EQ(2u, store.size());
+    EXPECT_EQ(third, store.GetHandle(0));
+    EXPECT_DOUBLE_EQ(3.0, store.Position().x[0]);
+    EXPECT_EQ(0u, store.IndexOf(third));
+    EXPECT_EQ(1u, store.IndexOf(second));
+
+    // Removing the last entry leaves the others alone.
+    EXPECT_TRUE(store.Remove(second));
+    EXPECT_EQ(0u, store.IndexOf(third));
+    EXPECT_EQ(1u, store.size());
+}
+
+TEST(particle_store_test, stale_handles_are_rejected) {
+    solo::physics::ParticleStore store;
+    const auto handle = store.Add(MakeParticle(1.0, 1.0));
+    EXPECT_TRUE(store.Contains(handle));
+    ASSERT_TRUE(store.Find(handle).has_value());
+    EXPECT_DOUBLE_EQ(1.0, store.Find(handle)->GetPosition().GetX());
+
+    EXPECT_TRUE(store.Remove(handle));
+    EXPECT_FALSE(store.Contains(handle));
+    EXPECT_FALSE(store.Remove(handle));
+    EXPECT_FALSE(store.Find(handle).has_value());
+
+    // The slot is reused under a new generation.
+    const auto reused = store.Add(MakeParticle(1.0, 5.0));
+    EXPECT_EQ(handle.index, reused.index);
+    EXPECT_NE(handle.generation, reused.generation);
+    EXPECT_FALSE(store.Contains(handle));
+    EXPECT_TRUE(store.Contains(reused));
+
+    EXPECT_FALSE(store.Contains(solo::physics::ParticleHandle()));
+}
+
+TEST(particle_store_test, reserved_handles_insert_later) {
+    solo::physics::ParticleStore store;
+    const auto reserved = store.ReserveHandle();
+    EXPECT_FALSE(store.Contains(reserved));
+
+    const auto added = store.Add(MakeParticle(1.0, 1.0));
+    EXPECT_NE(reserved, added);
+
+    store.Insert(MakeParticle(1.0, 9.0), reserved);
+    EXPECT_EQ(1u, store.IndexOf(reserved));
+    EXPECT_EQ(reserved, store[1].GetHandle());
+
+    store.Clear();
+    EXPECT_FALSE(store.Contains(reserved));
+    EXPECT_FALSE(store.Contains(added));
+}
+
+TEST(particle_store_test, sleeping_entries_trail_awake_ones) {
+    solo::physics::ParticleStore store;
+    std::vector<solo::physics::ParticleHandle> handles;
+    for (int i = 0; i < 6; ++i) {
+        handles.push_back(store.Add(MakeParticle(1.0, i)));
+    }
+    EXPECT_EQ(6u, store.GetAwakeCount());
+
+    store.Sleep(store.IndexOf(handles[1]));
+    store.Sleep(store.IndexOf(handles[3]));
+    EXPECT_EQ(4u, store.GetAwakeCount());
+    EXPECT_FALSE(store.IsAwake(store.IndexOf(handles[1])));
+    EXPECT_FALSE(store.IsAwake(store.IndexOf(handles[3])));
+
+    // New entries join the awake partition; removals keep it intact.
+    handles.push_back(store.Add(MakeParticle(1.0, 6.0)));
+    EXPECT_TRUE(store.IsAwake(store.IndexOf(handles[6])));
+    store.Remove(handles[0]);
+    store.Remove(handles[3]);
+    EXPECT_EQ(4u, store.GetAwakeCount());
+    EXPECT_EQ(5u, store.size());
+    EXPECT_FALSE(store.IsAwake(store.IndexOf(handles[1])));
+
+    // Handles follow their entries through every move.
+    for (std::size_t i = 1; i < handles.size(); ++i) {
+        if (i == 3) {
+            continue;
+        }
+        const auto found = store.Find(handles[i]);
+        ASSERT_TRUE(found.has_value());
+        EXPECT_DOUBLE_EQ(static_cast<double>(i),
+                         found->GetPosition().GetX());
+    }
+
+    const std::size_t index = store.Wake(store.IndexOf(handles[1]));
+    EXPECT_EQ(index, store.IndexOf(handles[1]));
+    EXPECT_EQ(5u, store.GetAwakeCount());
+}
+
+TEST(particle_store_test, groups_split_the_awake_range) {
+    solo::physics::ParticleStore store;
+    std::vector<solo::physics::ParticleHandle> handles;
+    for (int i = 0; i < 6; ++i) {
+        handles.push_back(store.Add(MakeParticle(1.0, i)));
+    }
+    EXPECT_EQ(1u, store.GetGroupCount());
+
+    store.SetGroup(store.IndexOf(handles[0]), 2);
+    store.SetGroup(store.IndexOf(handles[1]), 1);
+    store.SetGroup(store.IndexOf(handles[2]), 2);
+    EXPECT_EQ(3u, store.GetGroupCount());
+    store.Sleep(store.IndexOf(handles[2]));
+    store.Remove(handles[3]);
+    handles.push_back(store.Add(MakeParticle(1.0, 6.0)));
+
+    // Every awake entry lies inside the range of its own group.
+    const auto& groups = store.Groups();
+    std::size_t covered = 0;
+    for (std::uint32_t group = 0; group < store.GetGroupCount(); ++group) {
+        const auto [begin, end] = store.GetGroupRange(group);
+        EXPECT_EQ(covered, begin);
+        for (std::size_t i = begin; i < end; ++i) {
+            EXPECT_EQ(group, groups[i]);
+        }
+        covered = end;
+    }
+    EXPECT_EQ(store.GetAwakeCount(), covered);
+    EXPECT_EQ(5u, store.GetAwakeCount());
+
+    // Waking returns an entry to its group.
+    const std::size_t index = store.Wake(store.IndexOf(handles[2]));
+    EXPECT_EQ(2u, groups[index]);
+    EXPECT_EQ(2u, store.GetGroupRange(2).second - store.GetGroupRange(2).first);
+    EXPECT_EQ(2.0, store[index].GetPosition().GetX());
+    EXPECT_EQ(store.GetGroupRange(9).first, store.GetGroupRange(9).second);
+}
+
+TEST(particle_store_test, copies_and_batches_keep_groups) {
+    solo::physics::ParticleStore store;
+    std::vector<solo::physics::ParticleHandle> handles;
+    for (int i = 0; i < 4; ++i) {
+        handles.push_back(store.Add(MakeParticle(1.0, i)));
+    }
+    store.SetGroup(store.IndexOf(handles[1]), 1);
+    store.Sleep(store.IndexOf(handles[2]));
+
+    // Copies land together at the end of the first group.
+    const auto [first, last] = store.AddCopies(MakeParticle(2.0, 9.0), 40);
+    EXPECT_EQ(2u, first);
+    EXPECT_EQ(42u, last);
+    EXPECT_EQ(last, store.GetGroupRange(0).second);
+    for (std::size_t i = first; i < last; ++i) {
+        EXPECT_EQ(9.0, store[i].GetPosition().GetX());
+        EXPECT_EQ(i, store.IndexOf(store.GetHandle(i)));
+    }
+
+    // Enough removals for one compacting pass, with a stale handle.
+    std::vector<solo::physics::ParticleHandle> removed;
+    for (std::size_t i = first; i < last; i += 2) {
+        removed.push_back(store.GetHandle(i));
+    }
+    removed.push_back(handles[0]);
+    removed.push_back(handles[2]);
+    store.Remove(handles[3]);
+    removed.push_back(handles[3]);
+    EXPECT_EQ(22u, store.RemoveBatch(removed));
+    EXPECT_FALSE(store.Contains(handles[2]));
+
+    ASSERT_EQ(21u, store.size());
+    EXPECT_EQ(21u, store.GetAwakeCount());
+    EXPECT_EQ(20u, store.GetGroupRange(0).second);
+    EXPECT_EQ(20u, store.IndexOf(handles[1]));
+    for (std::size_t i = 0; i < store.size(); ++i) {
+        EXPECT_EQ(i, store.IndexOf(store.GetHandle(i)));
+    }
+}
+
+TEST(particle_store_test, copies_cross_populated_groups_and_sleepers) {
+    solo::physics::ParticleStore store;
+    std::vector<solo::physics::ParticleHandle> handles;
+    for (int i = 0; i < 30; ++i) {
+        handles.push_back(store.Add(MakeParticle(1.0, i)));
+        store.SetGroup(store.IndexOf(handles.back()),
+                       static_cast<std::uint32_t>(i % 5));
+    }
+    for (int i = 0; i < 30; i += 4) {
+        store.Sleep(store.IndexOf(handles[i]));
+    }
+    std::vector<std::size_t> sizes;
+    for (std::uint32_t group = 0; group < 5; ++group) {
+        const auto [first, last] = store.GetGroupRange(group);
+        sizes.push_back(last - first);
+    }
+    const std::size_t awake = store.GetAwakeCount();
+
+    // Bursts smaller and larger than the ranges they cross.
+    std::size_t added = 0;
+    for (const std::size_t count : {3u, 50u}) {
+        const auto [first, last] =
+            store.AddCopies(MakeParticle(2.0, 100.0), count);
+        added += count;
+        EXPECT_EQ(count, last - first);
+        EXPECT_EQ(last, store.GetGroupRange(0).second);
+        EXPECT_EQ(sizes[0] + added, last);
+        for (std::size_t i = first; i < last; ++i) {
+            EXPECT_EQ(100.0, store[i].GetPosition().GetX());
+            EXPECT_EQ(0u, store.Groups()[i]);
+        }
+    }
+
+    // Every other entry kept its group and sleep state.
+    EXPECT_EQ(awake + added, store.GetAwakeCount());
+    for (std::uint32_t group = 1; group < 5; ++group) {
+        const auto [first, last] = store.GetGroupRange(group);
+        EXPECT_EQ(sizes[group], last - first);
+        for (std::size_t i = first; i < last; ++i) {
+            EXPECT_EQ(group, store.Groups()[i]);
+        }
+    }
+    for (int i = 0; i < 30; ++i) {
+        const std::size_t index = store.IndexOf(handles[i]);
+        EXPECT_EQ(static_cast<double>(i), store[index].GetPosition().GetX());
+        EXPECT_EQ(i % 4 != 0, store.IsAwake(index));
+        EXPECT_EQ(static_cast<std::uint32_t>(i % 5), store.Groups()[index]);
+    }
+    for (std::size_t i = 0; i < store.size(); ++i) {
+        EXPECT_EQ(i, store.IndexOf(store.GetHandle(i)));
+    }
+}
+
+TEST(particle_store_test, reorder_keeps_handles) {
+    solo::physics::ParticleStore store;
+    std::vector<solo::physics::ParticleHandle> handles;
+    for (int i = 0; i < 5; ++i) {
+        handles.push_back(store.Add(MakeParticle(1.0 + i, i)));
+    }
+
+    store.Reorder(1, {3, 2, 0, 1}, nullptr, 2);
+    const double expected[] = {0.0, 4.0, 3.0, 1.0, 2.0};
+    for (std::size_t i = 0; i < store.size(); ++i) {
+        EXPECT_EQ(expected[i], store[i].GetPosition().GetX());
+        EXPECT_EQ(1.0 + expected[i], store[i].GetMass());
+    }
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(static_cast<double>(i),
+                  store[store.IndexOf(handles[i])].GetPosition().GetX());
+    }
+    EXPECT_THROW(store.Reorder(3, {0, 1, 2}, nullptr, 2), std::out_of_range);
+}
+
+TEST(particle_store_test, local_frames_hold_exact_positions) {
+    solo::physics::ParticleStore store;
+    const auto first = store.Add(MakeParticle(1.0, 6378137.25));
+    const auto second = store.Add(MakeParticle(1.0, -3000.5));
+    EXPECT_THROW(store.EnableLocalFrames(0.0), std::invalid_argument);
+    EXPECT_FALSE(store.HasLocalFrames());
+
+    store.EnableLocalFrames(1024.0);
+    ASSERT_TRUE(store.HasLocalFrames());
+    for (std::size_t i = 0; i < store.size(); ++i) {
+        EXPECT_LE(std::abs(store.LocalPosition().x[i]), 512.0f);
+    }
+    EXPECT_DOUBLE_EQ(6378137.25, store.GetPosition(0).GetX());
+    EXPECT_DOUBLE_EQ(-3000.5, store.GetPosition(1).GetX());
+
+    // An offset pushed past its region is moved onto the next one.
+    store.LocalPosition().x[0] += 2048.0f;
+    EXPECT_EQ(1u, store.Rebase(0, store.size()));
+    EXPECT_LE(std::abs(store.LocalPosition().x[0]), 512.0f);
+    EXPECT_DOUBLE_EQ(6380185.25, store.GetPosition(0).GetX());
+    EXPECT_EQ(0u, store.Rebase(0, store.size()));
+
+    // The double columns catch up on a sync; the getters never lag.
+    store.SetPosition(1, solo::math::WorldCoordinates(1.0e7, 2.0, 3.0));
+    EXPECT_DOUBLE_EQ(1.0e7, store.GetPosition(1).GetX());
+    EXPECT_DOUBLE_EQ(6378137.25, store.Position().x[0]);
+    store.SyncPositions(0, store.size());
+    EXPECT_DOUBLE_EQ(6380185.25, store.Position().x[0]);
+    EXPECT_DOUBLE_EQ(1.0e7, store.Position().x[1]);
+
+    // Frames move with their entries.
+    store.Remove(first);
+    ASSERT_EQ(1u, store.size());
+    EXPECT_DOUBLE_EQ(1.0e7, store[store.IndexOf(second)].GetPosition().GetX());
+    const auto third = store.Add(MakeParticle(1.0, 5000.0));
+    EXPECT_DOUBLE_EQ(5000.0, store[store.IndexOf(third)].GetPosition().GetX());
+}
+
+TEST(particle_store_test, closed_form_motion_extrapolates_references) {
+    solo::physics::ParticleStore store;
+    const auto first = store.Add(MakeParticle(1.0, 1.0));
+    store.EnableClosedFormMotion();
+    EXPECT_THROW(store.EnableLocalFrames(), std::logic_error);
+
+    store.AdvanceMotionTime(2.0);
+    EXPECT_DOUBLE_EQ(10.0, store.GetPosition(0).GetX());
+    EXPECT_DOUBLE_EQ(12.0, store.GetPosition(0).GetY());
+    EXPECT_DOUBLE_EQ(14.0, store.GetPosition(0).GetZ());
+    EXPECT_FLOAT_EQ(5.0f, store.GetVelocity(0).GetX());
+    EXPECT_FLOAT_EQ(5.0f, store.GetVelocity(0).GetZ());
+
+    // The columns wait for a sync.
+    EXPECT_DOUBLE_EQ(1.0, store.Position().x[0]);
+    store.SyncPositions(0, store.size());
+    EXPECT_DOUBLE_EQ(10.0, store.Position().x[0]);
+    EXPECT_FLOAT_EQ(5.0f, store.Velocity().x[0]);
+
+    // A new acceleration holds from the time it is set.
+    store[0].SetAcceleration(solo::math::Vector(0.0f, 0.0f, 0.0f));
+    store[0].SetAngularVelocity(solo::math::Vector(1.0f, 0.0f, 0.0f));
+    store.AdvanceMotionTime(1.0);
+    EXPECT_DOUBLE_EQ(15.0, store.GetPosition(0).GetX());
+    EXPECT_FLOAT_EQ(1.1f, store[0].GetAngle().GetX());
+
+    // Entries added later start from the current motion time and keep
+    // their own reference through moves.
+    const auto second = store.Add(MakeParticle(1.0, 0.0));
+    store.AdvanceMotionTime(1.0);
+    EXPECT_DOUBLE_EQ(4.25,
+                     store[store.IndexOf(second)].GetPosition().GetX());
+    EXPECT_DOUBLE_EQ(20.0, store[store.IndexOf(first)].GetPosition().GetX());
+    store.Remove(first);
+    EXPECT_DOUBLE_EQ(4.25, store.Get(0).GetPosition().GetX());
+    EXPECT_FLOAT_EQ(4.5f, store.Get(0).GetVelocity().GetX());
+}
+
+}  // namespace
@@ -0,0 +1,202 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Physics/BarnesHut.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Particle/Particle.h"
+#include "Particle/ParticleStore.h"
+#include "Threading/ThreadPool.h"
+
+#include "particle_cloud.h"
+
+namespace {
+
+using solo::physics::BarnesHut;
+using solo::physics::BarnesHutSettings;
+using solo::physics::ParticleStore;
+using solo::physics::VectorColumns;
+
+ParticleStore MakeCluster(std::size_t count) {
+    std::uniform_real_distribution<double> mass(1.0e6, 1.0e8);
+    return solo::physics::test::MakeCloud(
+        count, 3, std::normal_distribution<double>(0.0, 100.0),
+        [&mass](solo::physics::Particle& particle, std::size_t,
+                std::mt19937& generator) {
+            particle.SetMass(mass(generator));
+        });
+}
+
+VectorColumns<float> Zeroed(std::size_t count) {
+    VectorColumns<float> columns;
+    columns.x.assign(count, 0.0f);
+    columns.y.assign(count, 0.0f);
+    columns.z.assign(count, 0.0f);
+    return columns;
+}
+
+std::vector<double> DirectSum(const ParticleStore& store,
+                              const BarnesHutSettings& settings,
+                              std::size_t i) {
+    const auto& p = store.Position();
+    std::vector<double> a(3, 0.0);
+    for (std::size_t j = 0; j < store.size(); ++j) {
+        if (j == i) {
+            continue;
+        }
+        const double dx = p.x[j] - p.x[i];
+        const double dy = p.y[j] - p.y[i];
+        const double dz = p.z[j] - p.z[i];
+        const double r2 = dx * dx + dy * dy + dz * dz +
+                          settings.softening * settings.softening;
+        const double s =
+            settings.gravitational_constant * store.Mass()[j] / (r2 * std::sqrt(r2));
+        a[0] += s * dx;
+        a[1] += s * dy;
+        a[2] += s * dz;
+    }
+    return a;
+}
+
+TEST(barnes_hut_test, two_bodies_attract_by_inverse_square) {
+    ParticleStore store;
+    store.Add(solo::physics::Particle(1.0e10));
+    solo::physics::Particle second(2.0e10);
+    second.SetPosition(solo::math::WorldCoordinates(10.0, 0.0, 0.0));
+    store.Add(second);
+
+    BarnesHutSettings settings;
+    settings.softening = 0.0;
+    BarnesHut gravity(settings);
+    VectorColumns<float> acceleration = Zeroed(2);
+    gravity.Accumulate(store, acceleration);
+
+    const double g = settings.gravitational_constant;
+    EXPECT_NEAR(g * 2.0e10 / 100.0, acceleration.x[0], 1e-6);
+    EXPECT_NEAR(-g * 1.0e10 / 100.0, acceleration.x[1], 1e-6);
+    EXPECT_FLOAT_EQ(0.0f, acceleration.y[0]);
+}
+
+TEST(barnes_hut_test, zero_opening_angle_is_direct_summation) {
+    const ParticleStore store = MakeCluster(600);
+    BarnesHutSettings settings;
+    settings.opening_angle = 0.0;
+    BarnesHut gravity(settings);
+    VectorColumns<float> acceleration = Zeroed(store.size());
+    gravity.Accumulate(store, acceleration);
+
+    for (std::size_t i = 0; i < store.size(); i += 37) {
+        const auto expected = DirectSum(store, settings, i);
+        EXPECT_NEAR(expected[0], acceleration.x[i],
+                    1e-5 * std::abs(expected[0]) + 1e-12);
+        EXPECT_NEAR(expected[2], acceleration.z[i],
+                    1e-5 * std::abs(expected[2]) + 1e-12);
+    }
+}
+
+/// Root mean square error of every stride-th body from first on against
+/// direct summation, relative to the exact magnitude
+double RelativeError(const ParticleStore& store,
+                     const BarnesHutSettings& settings,
+                     const VectorColumns<float>& acceleration,
+                     std::size_t first, std::size_t stride) {
+    double error = 0.0;
+    double magnitude = 0.0;
+    for (std::size_t i = first; i < store.size(); i += stride) {
+        const auto expected = DirectSum(store, settings, i);
+        const double ex = acceleration.x[i] - expected[0];
+        const double ey = acceleration.y[i] - expected[1];
+        const double ez = acceleration.z[i] - expected[2];
+        error += ex * ex + ey * ey + ez * ez;
+        magnitude += expected[0] * expected[0] + expected[1] * expected[1] +
+                     expected[2] * expected[2];
+    }
+    return std::sqrt(error / magnitude);
+}
+
+TEST(barnes_hut_test, approximation_error_is_small) {
+    const ParticleStore store = MakeCluster(20000);
+    BarnesHutSettings settings;
+    settings.opening_angle = 0.5;
+
+    solo::threading::ThreadPool pool(4);
+    BarnesHut gravity(settings);
+    VectorColumns<float> acceleration = Zeroed(store.size());
+    gravity.Accumulate(store, acceleration, &pool);
+    EXPECT_GT(gravity.GetNodeCount(), store.size() / 16);
+    EXPECT_LT(RelativeError(store, settings, acceleration, 0, 97), 0.01);
+
+    // The result does not depend on the thread count.
+    BarnesHut serial(settings);
+    VectorColumns<float> serial_acceleration = Zeroed(store.size());
+    serial.Accumulate(store, serial_acceleration);
+    EXPECT_EQ(serial_acceleration.x, acceleration.x);
+    EXPECT_EQ(serial_acceleration.z, acceleration.z);
+
+    // Wide opening angles stay bounded too.
+    for (const double opening_angle : {0.7, 1.0}) {
+        settings.opening_angle = opening_angle;
+        BarnesHut wide(settings);
+        VectorColumns<float> wide_acceleration = Zeroed(store.size());
+        wide.Accumulate(store, wide_acceleration, &pool);
+        EXPECT_LT(RelativeError(store, settings, wide_acceleration, 0, 97),
+                  0.05 * opening_angle);
+    }
+
+    // A cell holding the group can pass the opening test from the group's
+    // bounds once the angle exceeds 1/sqrt(3), when its centre of mass
+    // lies far from the group. It must still be opened, or the group's
+    // bodies would count twice.
+    ParticleStore lopsided;
+    for (int i = 0; i < 16; ++i) {
+        solo::physics::Particle heavy(1.0e12);
+        heavy.SetPosition(solo::math::WorldCoordinates(
+            0.01 * i, 0.01 * (i % 4), 0.0));
+        lopsided.Add(heavy);
+    }
+    for (int i = 0; i < 2; ++i) {
+        solo::physics::Particle far(1.0e12);
+        far.SetPosition(
+            solo::math::WorldCoordinates(100.0, 100.0, 100.0 - 20.0 * i));
+        lopsided.Add(far);
+    }
+    for (const double opening_angle : {0.7, 1.0}) {
+        settings.opening_angle = opening_angle;
+        BarnesHut wide(settings);
+        VectorColumns<float> wide_acceleration = Zeroed(lopsided.size());
+        wide.Accumulate(lopsided, wide_acceleration);
+        EXPECT_LT(
+            RelativeError(lopsided, settings, wide_acceleration, 16, 1),
+            0.01);
+    }
+}
+
+TEST(barnes_hut_test, coincident_bodies_stay_finite) {
+    ParticleStore store;
+    for (int i = 0; i < 40; ++i) {
+        store.Add(solo::physics::Particle(1.0e9));
+    }
+    BarnesHut gravity;
+    VectorColumns<float> acceleration = Zeroed(store.size());
+    gravity.Accumulate(store, acceleration);
+    for (std::size_t i = 0; i < store.size(); ++i) {
+        EXPECT_TRUE(std::isfinite(acceleration.x[i]));
+    }
+}
+
+}  // namespace
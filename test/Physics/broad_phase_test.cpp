@@ -0,0 +1,136 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Physics/BroadPhase.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Particle/Particle.h"
+#include "Particle/ParticleStore.h"
+#include "Threading/ThreadPool.h"
+
+#include "particle_cloud.h"
+
+namespace {
+
+using solo::physics::BroadPhase;
+using solo::physics::CollisionPair;
+using solo::physics::ParticleStore;
+
+ParticleStore MakeCloud(std::size_t count) {
+    std::uniform_real_distribution<float> radius(0.0f, 1.5f);
+    return solo::physics::test::MakeCloud(
+        count, 7, std::uniform_real_distribution<double>(-40.0, 40.0),
+        [&radius](solo::physics::Particle& particle, std::size_t i,
+                  std::mt19937& generator) {
+            // Every tenth particle is a point without extent.
+            particle.SetRadius(i % 10 == 0 ? 0.0f : radius(generator));
+        });
+}
+
+std::vector<std::pair<std::size_t, std::size_t>> BruteForce(
+    const ParticleStore& store) {
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    for (std::size_t i = 0; i < store.size(); ++i) {
+        for (std::size_t j = i + 1; j < store.size(); ++j) {
+            const double ri = store.Radius()[i];
+            const double rj = store.Radius()[j];
+            if (ri <= 0.0 || rj <= 0.0) {
+                continue;
+            }
+            const double dx = store.Position().x[i] - store.Position().x[j];
+            const double dy = store.Position().y[i] - store.Position().y[j];
+            const double dz = store.Position().z[i] - store.Position().z[j];
+            if (dx * dx + dy * dy + dz * dz <= (ri + rj) * (ri + rj)) {
+                pairs.emplace_back(i, j);
+            }
+        }
+    }
+    return pairs;
+}
+
+std::vector<std::pair<std::size_t, std::size_t>> Indices(
+    const std::vector<CollisionPair>& pairs) {
+    std::vector<std::pair<std::size_t, std::size_t>> indices;
+    for (const CollisionPair& pair : pairs) {
+        indices.emplace_back(pair.first_index, pair.second_index);
+    }
+    return indices;
+}
+
+TEST(broad_phase_test, matches_brute_force) {
+    const ParticleStore store = MakeCloud(12000);
+    const auto expected = BruteForce(store);
+    ASSERT_FALSE(expected.empty());
+
+    BroadPhase serial;
+    serial.Update(store);
+    EXPECT_EQ(expected, Indices(serial.GetPairs()));
+
+    solo::threading::ThreadPool pool(4);
+    BroadPhase parallel;
+    parallel.Update(store, &pool);
+    EXPECT_EQ(expected, Indices(parallel.GetPairs()));
+
+    const CollisionPair& pair = parallel.GetPairs().front();
+    EXPECT_EQ(store.GetHandle(pair.first_index), pair.first);
+    EXPECT_EQ(store.GetHandle(pair.second_index), pair.second);
+}
+
+TEST(broad_phase_test, large_particles_keep_the_cells_small) {
+    // Equal radii throughout, so ties decide most pairs, and a few giants
+    // that overlap hundreds of particles each.
+    const ParticleStore store = solo::physics::test::MakeCloud(
+        6000, 11, std::uniform_real_distribution<double>(-40.0, 40.0),
+        [](solo::physics::Particle& particle, std::size_t i, std::mt19937&) {
+            particle.SetRadius(i % 1500 == 7 ? 20.0f : 1.0f);
+        });
+    const auto expected = BruteForce(store);
+
+    BroadPhase broad_phase;
+    broad_phase.Update(store);
+    EXPECT_DOUBLE_EQ(2.0, broad_phase.GetCellSize());
+    EXPECT_EQ(expected, Indices(broad_phase.GetPairs()));
+    for (const CollisionPair& pair : broad_phase.GetPairs()) {
+        EXPECT_EQ(store.GetHandle(pair.first_index), pair.first);
+        EXPECT_EQ(store.GetHandle(pair.second_index), pair.second);
+    }
+
+    solo::threading::ThreadPool pool(4);
+    BroadPhase parallel;
+    parallel.Update(store, &pool);
+    EXPECT_EQ(expected, Indices(parallel.GetPairs()));
+}
+
+TEST(broad_phase_test, points_without_extent_never_collide) {
+    ParticleStore store;
+    store.Add(solo::physics::Particle());
+    store.Add(solo::physics::Particle());
+
+    BroadPhase broad_phase;
+    broad_phase.Update(store);
+    EXPECT_TRUE(broad_phase.GetPairs().empty());
+
+    store[1].SetRadius(0.5f);
+    broad_phase.Update(store);
+    EXPECT_TRUE(broad_phase.GetPairs().empty());
+
+    store[0].SetRadius(0.5f);
+    broad_phase.Update(store);
+    ASSERT_EQ(1u, broad_phase.GetPairs().size());
+}
+
+}  // namespace
@@ -0,0 +1,223 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Physics/EmitterRegistry.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Math/Vector.h"
+#include "Particle/Particle.h"
+#include "Particle/ParticleStore.h"
+
+namespace {
+
+using solo::math::Vector;
+using solo::math::WorldCoordinates;
+using solo::physics::Emitter;
+using solo::physics::EmitterRegistry;
+using solo::physics::ParticleStore;
+
+// Exact in binary, so the rate adds up without rounding.
+constexpr double kTimeStep = 0.125;
+
+Emitter Fountain() {
+    Emitter emitter;
+    emitter.position = WorldCoordinates(10.0, 20.0, 30.0);
+    emitter.position_spread = Vector(1.0f, 2.0f, 0.0f);
+    emitter.velocity = Vector(0.0f, 0.0f, 5.0f);
+    emitter.velocity_spread = Vector(0.5f, 0.5f, 1.0f);
+    emitter.acceleration = Vector(0.0f, 0.0f, -9.81f);
+    emitter.mass = 0.25;
+    emitter.radius = 0.1f;
+    emitter.tags = 4;
+    emitter.lifetime = 1.0;
+    emitter.lifetime_spread = 0.25;
+    emitter.capacity = 4096;
+    return emitter;
+}
+
+TEST(emitter_registry_test, rate_spawns_evenly) {
+    ParticleStore store;
+    EmitterRegistry registry;
+    Emitter emitter = Fountain();
+    emitter.rate = 20.0;
+    emitter.lifetime = 100.0;
+    const auto id = registry.Add(emitter, store);
+
+    // 2.5 particles per step: the fractions carry over.
+    EXPECT_EQ(2u, registry.Spawn(store, kTimeStep));
+    EXPECT_EQ(3u, registry.Spawn(store, kTimeStep));
+    for (int i = 0; i < 6; ++i) {
+        registry.Spawn(store, kTimeStep);
+    }
+    EXPECT_EQ(20u, store.size());
+    EXPECT_EQ(20u, registry.GetLiveCount(id));
+    EXPECT_DOUBLE_EQ(1.0, registry.GetTime());
+}
+
+TEST(emitter_registry_test, bursts_copy_the_emitter) {
+    ParticleStore store;
+    store.Add(solo::physics::Particle(1.0));
+    EmitterRegistry registry;
+    const Emitter emitter = Fountain();
+    const auto id = registry.Add(emitter, store);
+
+    EXPECT_TRUE(registry.Burst(id, 1000));
+    EXPECT_FALSE(registry.Burst(id + 1, 1000));
+    EXPECT_EQ(1000u, registry.Spawn(store, kTimeStep));
+    ASSERT_EQ(1001u, store.size());
+    EXPECT_EQ(1001u, store.GetAwakeCount());
+
+    for (std::size_t i = 1; i < store.size(); ++i) {
+        const auto particle = store[i];
+        EXPECT_DOUBLE_EQ(0.25, particle.GetMass());
+        EXPECT_FLOAT_EQ(0.1f, particle.GetRadius());
+        EXPECT_EQ(4u, particle.GetTags());
+        EXPECT_FLOAT_EQ(-9.81f, particle.GetAcceleration().GetZ());
+
+        // Drawn state stays within the spreads.
+        const WorldCoordinates position = particle.GetPosition();
+        EXPECT_LE(std::abs(position.GetX() - 10.0), 1.0);
+        EXPECT_LE(std::abs(position.GetY() - 20.0), 2.0);
+        EXPECT_DOUBLE_EQ(30.0, position.GetZ());
+        const Vector velocity = particle.GetVelocity();
+        EXPECT_LE(std::abs(velocity.GetX()), 0.5f);
+        EXPECT_LE(std::abs(velocity.GetZ() - 5.0f), 1.0f);
+    }
+
+    // Handles of the batch resolve to it.
+    EXPECT_EQ(1000u, store.IndexOf(store.GetHandle(1000)));
+}
+
+TEST(emitter_registry_test, full_emitters_drop_spawns) {
+    ParticleStore store;
+    EmitterRegistry registry;
+    Emitter emitter = Fountain();
+    emitter.capacity = 100;
+    const auto id = registry.Add(emitter, store);
+
+    registry.Burst(id, 80);
+    registry.Spawn(store, kTimeStep);
+    registry.Burst(id, 80);
+    EXPECT_EQ(20u, registry.Spawn(store, kTimeStep));
+    EXPECT_EQ(100u, registry.GetLiveCount(id));
+    EXPECT_EQ(60u, registry.GetDroppedCount());
+}
+
+TEST(emitter_registry_test, lifetimes_expire_in_order) {
+    ParticleStore store;
+    EmitterRegistry registry;
+    Emitter emitter = Fountain();
+    emitter.lifetime = 0.5;
+    emitter.lifetime_spread = 0.0;
+    const auto id = registry.Add(emitter, store);
+
+    registry.Burst(id, 10);
+    registry.Spawn(store, kTimeStep);
+    registry.Burst(id, 5);
+    registry.Spawn(store, kTimeStep);
+
+    // The first batch ends at 0.5 s, the second at 0.625 s.
+    EXPECT_TRUE(registry.Expire().empty());
+    registry.Spawn(store, kTimeStep);
+    registry.Spawn(store, kTimeStep);
+    EXPECT_EQ(10u, registry.Expire().size());
+    EXPECT_EQ(5u, registry.GetLiveCount(id));
+    registry.Spawn(store, kTimeStep);
+    const auto& expired = registry.Expire();
+    ASSERT_EQ(5u, expired.size());
+    for (const auto handle : expired) {
+        EXPECT_GE(store.IndexOf(handle), 10u);
+    }
+    EXPECT_EQ(0u, registry.GetLiveCount(id));
+}
+
+TEST(emitter_registry_test, lifetimes_stay_within_spread) {
+    ParticleStore store;
+    EmitterRegistry registry;
+    const auto id = registry.Add(Fountain(), store);
+    registry.Burst(id, 1000);
+    registry.Spawn(store, kTimeStep);
+
+    // Lifetimes lie in [0.75, 1.25) from the spawn at 0.
+    std::size_t expired = 0;
+    for (int step = 1; step <= 11; ++step) {
+        expired += registry.Expire().size();
+        if (step <= 5) {
+            EXPECT_EQ(0u, expired);
+        }
+        registry.Spawn(store, kTimeStep);
+    }
+    EXPECT_EQ(1000u, expired);
+}
+
+TEST(emitter_registry_test, seeds_repeat) {
+    ParticleStore first_store;
+    ParticleStore second_store;
+    EmitterRegistry first;
+    EmitterRegistry second;
+    Emitter emitter = Fountain();
+    emitter.rate = 100.0;
+    first.Add(emitter, first_store);
+    second.Add(emitter, second_store);
+    for (int i = 0; i < 4; ++i) {
+        first.Spawn(first_store, kTimeStep);
+        second.Spawn(second_store, kTimeStep);
+    }
+
+    ASSERT_EQ(first_store.size(), second_store.size());
+    for (std::size_t i = 0; i < first_store.size(); ++i) {
+        EXPECT_DOUBLE_EQ(first_store[i].GetPosition().GetX(),
+                         second_store[i].GetPosition().GetX());
+        EXPECT_FLOAT_EQ(first_store[i].GetVelocity().GetY(),
+                        second_store[i].GetVelocity().GetY());
+    }
+}
+
+TEST(emitter_registry_test, removed_emitters_stop_spawning) {
+    ParticleStore store;
+    EmitterRegistry registry;
+    Emitter emitter = Fountain();
+    emitter.rate = 80.0;
+    const auto id = registry.Add(emitter, store);
+    registry.Spawn(store, kTimeStep);
+
+    EXPECT_TRUE(registry.Remove(id));
+    EXPECT_FALSE(registry.Remove(id));
+    EXPECT_EQ(nullptr, registry.Find(id));
+    EXPECT_TRUE(registry.empty());
+    EXPECT_EQ(0u, registry.Spawn(store, kTimeStep));
+
+    // Its particles still expire.
+    for (int i = 0; i < 10; ++i) {
+        registry.Spawn(store, kTimeStep);
+    }
+    EXPECT_EQ(10u, registry.Expire().size());
+}
+
+TEST(emitter_registry_test, invalid_emitters_throw) {
+    ParticleStore store;
+    EmitterRegistry registry;
+    Emitter emitter = Fountain();
+    emitter.rate = -1.0;
+    EXPECT_THROW(registry.Add(emitter, store), std::invalid_argument);
+    emitter.rate = 1.0;
+    emitter.lifetime_spread = emitter.lifetime;
+    EXPECT_THROW(registry.Add(emitter, store), std::invalid_argument);
+    EXPECT_TRUE(registry.empty());
+}
+
+}  // namespace
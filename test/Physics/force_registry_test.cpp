@@ -0,0 +1,130 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Physics/ForceRegistry.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include "Math/Vector.h"
+#include "Particle/Particle.h"
+#include "Particle/ParticleStore.h"
+#include "Threading/ThreadPool.h"
+
+namespace {
+
+using solo::math::Vector;
+using solo::physics::ForceGenerator;
+using solo::physics::ForceRegistry;
+using solo::physics::ParticleStore;
+using solo::physics::VectorColumns;
+
+constexpr std::uint32_t kAircraft = 1u << 0;
+constexpr std::uint32_t kVessel = 1u << 1;
+
+TEST(force_registry_test, generators_target_tags) {
+    ParticleStore store;
+    solo::physics::Particle untagged(2.0);
+    untagged.SetAcceleration(Vector(1.0f, 0.0f, 0.0f));
+    solo::physics::Particle vessel(2.0);
+    vessel.SetTags(kVessel);
+    store.Add(untagged);
+    store.Add(vessel);
+
+    ForceRegistry registry;
+    registry.Add(ForceGenerator::Gravity(Vector(0.0f, 0.0f, -9.81f)));
+    registry.Add(ForceGenerator::Gravity(Vector(0.0f, 3.0f, 0.0f), kVessel));
+    registry.Add(ForceGenerator::Gravity(Vector(5.0f, 0.0f, 0.0f), kAircraft));
+
+    VectorColumns<float> acceleration;
+    registry.Apply(store, acceleration);
+    ASSERT_EQ(2u, acceleration.x.size());
+
+    // The particle's own acceleration is carried through.
+    EXPECT_FLOAT_EQ(1.0f, acceleration.x[0]);
+    EXPECT_FLOAT_EQ(0.0f, acceleration.y[0]);
+    EXPECT_FLOAT_EQ(-9.81f, acceleration.z[0]);
+    EXPECT_FLOAT_EQ(0.0f, acceleration.x[1]);
+    EXPECT_FLOAT_EQ(3.0f, acceleration.y[1]);
+    EXPECT_FLOAT_EQ(-9.81f, acceleration.z[1]);
+}
+
+TEST(force_registry_test, drag_opposes_relative_velocity) {
+    ParticleStore store;
+    solo::physics::Particle moving(4.0);
+    moving.SetVelocity(Vector(3.0f, 4.0f, 0.0f));
+    solo::physics::Particle drifting(4.0);
+    solo::physics::Particle massless(0.0);
+    massless.SetVelocity(Vector(1.0f, 0.0f, 0.0f));
+    store.Add(moving);
+    store.Add(drifting);
+    store.Add(massless);
+
+    ForceRegistry registry;
+    const auto drag = registry.Add(ForceGenerator::Drag(0.5f));
+    VectorColumns<float> acceleration;
+    registry.Apply(store, acceleration);
+
+    // a = -c |v| v / m
+    EXPECT_FLOAT_EQ(-0.5f * 5.0f * 3.0f / 4.0f, acceleration.x[0]);
+    EXPECT_FLOAT_EQ(-0.5f * 5.0f * 4.0f / 4.0f, acceleration.y[0]);
+    EXPECT_FLOAT_EQ(0.0f, acceleration.x[1]);
+    EXPECT_FLOAT_EQ(0.0f, acceleration.x[2]);
+
+    // A current pushes a particle at rest along with it.
+    EXPECT_TRUE(registry.Remove(drag));
+    EXPECT_FALSE(registry.Remove(drag));
+    registry.Add(ForceGenerator::Current(Vector(0.0f, -2.0f, 0.0f), 1.0f));
+    registry.Apply(store, acceleration);
+    EXPECT_FLOAT_EQ(-2.0f * 2.0f / 4.0f, acceleration.y[1]);
+}
+
+TEST(force_registry_test, pool_matches_serial) {
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<float> speed(-20.0f, 20.0f);
+    std::uniform_int_distribution<std::uint32_t> tags(0, 3);
+    ParticleStore store;
+    for (int i = 0; i < 50000; ++i) {
+        solo::physics::Particle particle(1.0 + i % 7);
+        particle.SetVelocity(
+            Vector(speed(generator), speed(generator), speed(generator)));
+        particle.SetTags(tags(generator));
+        store.Add(particle);
+    }
+
+    ForceRegistry registry;
+    registry.Add(ForceGenerator::Gravity(Vector(0.0f, 0.0f, -9.81f)));
+    registry.Add(ForceGenerator::Drag(0.01f, kAircraft));
+    registry.Add(ForceGenerator::Wind(Vector(5.0f, 1.0f, 0.0f), 0.02f,
+                                      kAircraft));
+    registry.Add(ForceGenerator::Current(Vector(0.0f, 1.5f, 0.0f), 0.3f,
+                                         kVessel));
+
+    VectorColumns<float> serial;
+    registry.Apply(store, serial);
+
+    solo::threading::ThreadPool pool(4);
+    VectorColumns<float> parallel;
+    registry.Apply(store, parallel, &pool);
+
+    EXPECT_EQ(serial.x, parallel.x);
+    EXPECT_EQ(serial.y, parallel.y);
+    EXPECT_EQ(serial.z, parallel.z);
+    for (std::size_t i = 0; i < store.size(); ++i) {
+        ASSERT_TRUE(std::isfinite(serial.x[i]));
+    }
+}
+
+}  // namespace
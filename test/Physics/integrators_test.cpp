@@ -0,0 +1,92 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Physics/Integrators.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+using solo::physics::RungeKutta4;
+using solo::physics::SymplecticEuler;
+using solo::physics::VelocityVerlet;
+
+/// @brief Runs a unit harmonic oscillator, a = -x, from x = 1 at rest with
+/// one acceleration evaluation per step, as the engine does.
+/// @return Largest deviation of the energy from its initial 0.5
+template <typename Integrator>
+double OscillatorEnergyError(float step, int steps) {
+    double position = 1.0;
+    float velocity = 0.0f;
+    float previous = -1.0f;
+    double worst = 0.0;
+    for (int i = 0; i < steps; ++i) {
+        const auto acceleration = static_cast<float>(-position);
+        Integrator::Step(position, velocity, acceleration, previous, step);
+        previous = acceleration;
+        const double energy =
+            0.5 * (position * position +
+                   static_cast<double>(velocity) * velocity);
+        worst = std::max(worst, std::abs(energy - 0.5));
+    }
+    return worst;
+}
+
+/// @brief Falls under constant acceleration for a whole number of steps
+template <typename Integrator>
+double FallDistance(float step, int steps) {
+    double position = 0.0;
+    float velocity = 0.0f;
+    for (int i = 0; i < steps; ++i) {
+        Integrator::Step(position, velocity, -10.0f, -10.0f, step);
+    }
+    return position;
+}
+
+TEST(integrators_test, constant_acceleration) {
+    // 1 s of free fall: 5 m exactly for the second order schemes.
+    EXPECT_NEAR(-5.0, FallDistance<VelocityVerlet>(0.1f, 10), 1e-5);
+    EXPECT_NEAR(-5.0, FallDistance<RungeKutta4>(0.1f, 10), 1e-5);
+    // Semi-implicit Euler overshoots by half a step's worth.
+    EXPECT_NEAR(-5.5, FallDistance<SymplecticEuler>(0.1f, 10), 1e-5);
+}
+
+TEST(integrators_test, symplectic_schemes_keep_oscillator_energy) {
+    // A thousand periods at 60 steps per period.
+    const float step = 2.0f * 3.14159265f / 60.0f;
+    const int steps = 60000;
+    const double euler = OscillatorEnergyError<SymplecticEuler>(step, steps);
+    const double verlet = OscillatorEnergyError<VelocityVerlet>(step, steps);
+
+    // Bounded rather than growing, and Verlet an order better.
+    EXPECT_LT(euler, 0.06);
+    EXPECT_LT(verlet, 0.006);
+}
+
+TEST(integrators_test, runge_kutta_follows_changing_acceleration) {
+    // a(t) = t from rest: x(t) = t^3 / 6, v(t) = t^2 / 2.
+    const float step = 0.1f;
+    double position = 0.0;
+    float velocity = 0.0f;
+    float previous = -step;
+    for (int i = 0; i < 20; ++i) {
+        const float acceleration = static_cast<float>(i) * step;
+        RungeKutta4::Step(position, velocity, acceleration, previous, step);
+        previous = acceleration;
+    }
+    EXPECT_NEAR(8.0 / 6.0, position, 1e-5);
+    EXPECT_NEAR(2.0, velocity, 1e-5);
+}
+
+}  // namespace
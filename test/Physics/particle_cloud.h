@@ -0,0 +1,61 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+
+#ifndef SOLO_TEST_PHYSICS_PARTICLE_CLOUD_H
+#define SOLO_TEST_PHYSICS_PARTICLE_CLOUD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Particle/Particle.h"
+#include "Particle/ParticleStore.h"
+
+namespace solo {
+namespace physics {
+namespace test {
+
+/// @brief Store of particles at reproducible random positions
+/// @param count Number of particles
+/// @param seed Seed of the generator, so every run sees the same cloud
+/// @param coordinate Distribution each coordinate is drawn from
+/// @param customise Called as customise(particle, index, generator) after
+/// the position is set, to draw any further properties
+template <typename Distribution, typename Customise>
+ParticleStore MakeCloud(std::size_t count, std::uint32_t seed,
+                        Distribution coordinate, Customise customise) {
+    std::mt19937 generator(seed);
+    ParticleStore store;
+    for (std::size_t i = 0; i < count; ++i) {
+        Particle particle;
+        particle.SetPosition(math::WorldCoordinates(
+            coordinate(generator), coordinate(generator), coordinate(generator)));
+        customise(particle, i, generator);
+        store.Add(particle);
+    }
+    return store;
+}
+
+/// @brief Store of default particles at reproducible random positions
+template <typename Distribution>
+ParticleStore MakeCloud(std::size_t count, std::uint32_t seed,
+                        Distribution coordinate) {
+    return MakeCloud(count, seed, coordinate,
+                     [](Particle&, std::size_t, std::mt19937&) {});
+}
+
+}  // namespace test
+}  // namespace physics
+}  // namespace solo
+
+#endif  // SOLO_TEST_PHYSICS_PARTICLE_CLOUD_H
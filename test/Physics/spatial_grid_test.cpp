@@ -0,0 +1,156 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Physics/SpatialGrid.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "Coordinates/WorldCoordinates.h"
+#include "Particle/ParticleStore.h"
+#include "Threading/ThreadPool.h"
+
+#include "particle_cloud.h"
+
+namespace {
+
+using solo::math::WorldCoordinates;
+using solo::physics::Neighbour;
+using solo::physics::ParticleStore;
+using solo::physics::SpatialGrid;
+
+ParticleStore MakeCloud(std::size_t count, double extent) {
+    return solo::physics::test::MakeCloud(
+        count, 42, std::uniform_real_distribution<double>(-extent, extent));
+}
+
+double DistanceSquared(const ParticleStore& store, std::size_t index,
+                       const WorldCoordinates& point) {
+    const double dx = store.Position().x[index] - point.GetX();
+    const double dy = store.Position().y[index] - point.GetY();
+    const double dz = store.Position().z[index] - point.GetZ();
+    return dx * dx + dy * dy + dz * dz;
+}
+
+TEST(spatial_grid_test, radius_query_matches_linear_scan) {
+    const ParticleStore store = MakeCloud(5000, 50.0);
+    solo::threading::ThreadPool pool(4);
+    SpatialGrid grid(4.0);
+    grid.Build(store, &pool);
+    ASSERT_EQ(store.size(), grid.size());
+
+    std::vector<std::size_t> found;
+    for (double radius : {0.5, 3.0, 10.0, 500.0}) {
+        const WorldCoordinates center(1.5, -7.25, 20.0);
+        grid.QueryRadius(center, radius, found);
+        std::sort(found.begin(), found.end());
+
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 0; i < store.size(); ++i) {
+            if (DistanceSquared(store, i, center) <= radius * radius) {
+                expected.push_back(i);
+            }
+        }
+        EXPECT_EQ(expected, found) << "radius " << radius;
+    }
+}
+
+TEST(spatial_grid_test, box_query_matches_linear_scan) {
+    const ParticleStore store = MakeCloud(5000, 50.0);
+    SpatialGrid grid(5.0);
+    grid.Build(store);
+
+    const WorldCoordinates low(-10.0, 0.0, -30.0);
+    const WorldCoordinates high(12.0, 4.0, 30.0);
+    std::vector<std::size_t> found;
+    grid.QueryBox(low, high, found);
+    std::sort(found.begin(), found.end());
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < store.size(); ++i) {
+        const double x = store.Position().x[i];
+        const double y = store.Position().y[i];
+        const double z = store.Position().z[i];
+        if (x >= -10.0 && x <= 12.0 && y >= 0.0 && y <= 4.0 && z >= -30.0 &&
+            z <= 30.0) {
+            expected.push_back(i);
+        }
+    }
+    EXPECT_EQ(expected, found);
+}
+
+TEST(spatial_grid_test, nearest_query_matches_linear_scan) {
+    const ParticleStore store = MakeCloud(5000, 50.0);
+    SpatialGrid grid(2.0);
+    grid.Build(store);
+
+    std::vector<Neighbour> found;
+    // Inside the cloud and far outside it, which falls back to a scan.
+    for (const WorldCoordinates& center :
+         {WorldCoordinates(0.0, 0.0, 0.0), WorldCoordinates(49.0, -49.0, 10.0),
+          WorldCoordinates(1000.0, 0.0, 0.0)}) {
+        grid.QueryNearest(center, 16, found);
+        ASSERT_EQ(16u, found.size());
+
+        std::vector<double> expected;
+        for (std::size_t i = 0; i < store.size(); ++i) {
+            expected.push_back(DistanceSquared(store, i, center));
+        }
+        std::sort(expected.begin(), expected.end());
+        for (std::size_t k = 0; k < found.size(); ++k) {
+            EXPECT_DOUBLE_EQ(expected[k], found[k].distance_squared);
+            EXPECT_DOUBLE_EQ(expected[k],
+                             DistanceSquared(store, found[k].index, center));
+        }
+    }
+
+    // Asking for more than exist returns everything.
+    grid.QueryNearest(WorldCoordinates(), 10000, found);
+    EXPECT_EQ(store.size(), found.size());
+}
+
+TEST(spatial_grid_test, rebuild_tracks_moved_particles) {
+    ParticleStore store = MakeCloud(100, 10.0);
+    SpatialGrid grid(1.0);
+    grid.Build(store);
+
+    store[7].SetPosition(WorldCoordinates(500.0, 500.0, 500.0));
+    grid.Build(store);
+
+    std::vector<std::size_t> found;
+    grid.QueryRadius(WorldCoordinates(500.0, 500.0, 500.0), 0.1, found);
+    ASSERT_EQ(1u, found.size());
+    EXPECT_EQ(7u, found[0]);
+
+    SpatialGrid empty;
+    empty.QueryRadius(WorldCoordinates(), 1.0, found);
+    EXPECT_TRUE(found.empty());
+}
+
+TEST(spatial_grid_test, rejects_invalid_cell_sizes) {
+    EXPECT_THROW(SpatialGrid(0.0), std::invalid_argument);
+    EXPECT_THROW(SpatialGrid(-1.0), std::invalid_argument);
+
+    SpatialGrid grid(2.0);
+    EXPECT_THROW(grid.SetCellSize(std::numeric_limits<double>::quiet_NaN()),
+                 std::invalid_argument);
+    EXPECT_THROW(grid.SetCellSize(std::numeric_limits<double>::infinity()),
+                 std::invalid_argument);
+    EXPECT_DOUBLE_EQ(2.0, grid.GetCellSize());
+}
+
+}  // namespace
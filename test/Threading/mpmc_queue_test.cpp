@@ -0,0 +1,73 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Threading/MpmcQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace {
+
+TEST(mpmc_queue_test, fifo_and_bounded) {
+    solo::threading::MpmcQueue<int> queue(2);
+    int value = 0;
+    EXPECT_FALSE(queue.TryPop(value));
+    EXPECT_TRUE(queue.TryPush(1));
+    EXPECT_TRUE(queue.TryPush(2));
+    EXPECT_FALSE(queue.TryPush(3));
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(1, value);
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(2, value);
+    EXPECT_FALSE(queue.TryPop(value));
+}
+
+TEST(mpmc_queue_test, concurrent_consumers_take_each_value_once) {
+    constexpr int value_count = 50000;
+    constexpr int consumer_count = 3;
+    solo::threading::MpmcQueue<int> queue(128);
+    std::vector<std::atomic<int>> taken(value_count);
+    std::atomic<int> received{0};
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < consumer_count; ++c) {
+        consumers.emplace_back([&]() {
+            int value = 0;
+            while (received.load() < value_count) {
+                if (queue.TryPop(value)) {
+                    taken[static_cast<std::size_t>(value)].fetch_add(1);
+                    received.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < value_count; ++i) {
+        while (!queue.TryPush(i)) {
+            std::this_thread::yield();
+        }
+    }
+    for (std::thread& consumer : consumers) {
+        consumer.join();
+    }
+
+    for (const std::atomic<int>& count : taken) {
+        ASSERT_EQ(1, count.load());
+    }
+}
+
+}  // namespace
@@ -0,0 +1,89 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Threading/MpscQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace {
+
+TEST(mpsc_queue_test, capacity_rounds_to_power_of_two) {
+    const solo::threading::MpscQueue<int> queue(100);
+    EXPECT_EQ(128u, queue.Capacity());
+}
+
+TEST(mpsc_queue_test, fifo_and_bounded) {
+    solo::threading::MpscQueue<int> queue(4);
+    int value = 0;
+    EXPECT_FALSE(queue.TryPop(value));
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.TryPush(i));
+    }
+    EXPECT_FALSE(queue.TryPush(4));
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_FALSE(queue.TryPop(value));
+
+    // Wrapping around reuses the cells.
+    EXPECT_TRUE(queue.TryPush(10));
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(10, value);
+}
+
+TEST(mpsc_queue_test, multiple_producers_deliver_everything) {
+    constexpr int producer_count = 4;
+    constexpr int per_producer = 20000;
+    solo::threading::MpscQueue<int> queue(256);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producer_count; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < per_producer; ++i) {
+                while (!queue.TryPush((p * per_producer) + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Values from one producer must arrive in the order they were pushed.
+    std::vector<int> last_seen(producer_count, -1);
+    std::vector<bool> seen(producer_count * per_producer, false);
+    int received = 0;
+    int value = 0;
+    while (received < producer_count * per_producer) {
+        if (!queue.TryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const int producer = value / per_producer;
+        EXPECT_GT(value % per_producer, last_seen[producer]);
+        last_seen[producer] = value % per_producer;
+        EXPECT_FALSE(seen[static_cast<std::size_t>(value)]);
+        seen[static_cast<std::size_t>(value)] = true;
+        ++received;
+    }
+
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    EXPECT_FALSE(queue.TryPop(value));
+}
+
+}  // namespace
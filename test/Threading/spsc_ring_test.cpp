@@ -0,0 +1,106 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Threading/SpscRing.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+
+namespace {
+
+using solo::threading::SpscRing;
+
+TEST(spsc_ring_test, capacity_rounds_to_power_of_two) {
+    const SpscRing<int> ring(100);
+    EXPECT_EQ(128u, ring.Capacity());
+}
+
+TEST(spsc_ring_test, spans_stop_at_the_wrap) {
+    SpscRing<int> ring(8);
+    EXPECT_EQ(8u, ring.GetFreeCount());
+    EXPECT_TRUE(ring.BeginRead().empty());
+
+    std::span<int> write = ring.BeginWrite(6);
+    ASSERT_EQ(6u, write.size());
+    for (std::size_t i = 0; i < write.size(); ++i) {
+        write[i] = static_cast<int>(i);
+    }
+    ring.CommitWrite(6);
+    EXPECT_EQ(2u, ring.GetFreeCount());
+    EXPECT_EQ(2u, ring.BeginWrite(5).size());
+
+    std::span<const int> read = ring.BeginRead();
+    ASSERT_EQ(6u, read.size());
+    EXPECT_EQ(5, read[5]);
+    ring.CommitRead(6);
+
+    // Five free slots remain past the wrap point, but only two before it.
+    write = ring.BeginWrite(5);
+    ASSERT_EQ(2u, write.size());
+    write[0] = 6;
+    write[1] = 7;
+    ring.CommitWrite(2);
+    write = ring.BeginWrite(3);
+    ASSERT_EQ(3u, write.size());
+    write[0] = 8;
+    ring.CommitWrite(3);
+    EXPECT_EQ(3u, ring.GetFreeCount());
+
+    read = ring.BeginRead();
+    ASSERT_EQ(2u, read.size());
+    EXPECT_EQ(6, read[0]);
+    ring.CommitRead(2);
+    read = ring.BeginRead();
+    ASSERT_EQ(3u, read.size());
+    EXPECT_EQ(8, read[0]);
+}
+
+TEST(spsc_ring_test, threads_exchange_in_order) {
+    constexpr std::uint64_t kCount = 1000000;
+    SpscRing<std::uint64_t> ring(1024);
+
+    std::thread producer([&ring] {
+        std::uint64_t next = 0;
+        while (next < kCount) {
+            const std::span<std::uint64_t> span = ring.BeginWrite(100);
+            if (span.empty()) {
+                std::this_thread::yield();
+                continue;
+            }
+            std::size_t written = 0;
+            for (; written < span.size() && next < kCount; ++written) {
+                span[written] = next++;
+            }
+            ring.CommitWrite(written);
+        }
+    });
+
+    std::uint64_t expected = 0;
+    while (expected < kCount) {
+        const std::span<const std::uint64_t> span = ring.BeginRead();
+        if (span.empty()) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (const std::uint64_t value : span) {
+            ASSERT_EQ(expected, value);
+            ++expected;
+        }
+        ring.CommitRead(span.size());
+    }
+    producer.join();
+}
+
+}  // namespace
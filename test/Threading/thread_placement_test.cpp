@@ -0,0 +1,59 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Threading/ThreadPlacement.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Threading/ThreadPool.h"
+
+namespace {
+
+using solo::threading::ThreadPlacement;
+
+TEST(thread_placement_test, default_placement_always_applies) {
+    EXPECT_TRUE(solo::threading::PlaceCurrentThread(ThreadPlacement{}));
+}
+
+TEST(thread_placement_test, impossible_placements_are_reported) {
+    ThreadPlacement placement;
+    placement.cpus = {1u << 20};
+
+    std::vector<ThreadPlacement> placements(2, placement);
+    const solo::threading::ThreadPool pool(3, placements);
+    EXPECT_EQ(2u, pool.GetPlacementFailures());
+
+    const solo::threading::ThreadPool unplaced(3);
+    EXPECT_EQ(0u, unplaced.GetPlacementFailures());
+}
+
+TEST(thread_placement_test, first_touch_keeps_contents) {
+    solo::threading::ThreadPool pool(3);
+
+    // Several pages, starting part way into one.
+    std::vector<std::uint32_t> column(300001);
+    for (std::size_t i = 0; i < column.size(); ++i) {
+        column[i] = static_cast<std::uint32_t>(i * 7 + 1);
+    }
+
+    solo::threading::FirstTouch(&pool, column, 4096);
+    solo::threading::FirstTouch(nullptr, column, 4096);
+    for (std::size_t i = 0; i < column.size(); ++i) {
+        ASSERT_EQ(static_cast<std::uint32_t>(i * 7 + 1), column[i])
+            << "index " << i;
+    }
+}
+
+}  // namespace
@@ -0,0 +1,95 @@
+// -----------------------------------------------------------------------------
+// Author:      Harrison Farrell
+// Project:     Solo-Engine Simulation Engine
+// Copyright:   (c) 2026 Harrison Farrell. All Rights Reserved.
+//
+// Licensed under the GNU Affero General Public License v3.0 (AGPL-3.0).
+// This program is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See <https://www.gnu.org/licenses/agpl-3.0.html> for full details.
+// -----------------------------------------------------------------------------
+
+#include "Threading/ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace {
+
+TEST(thread_pool_test, zero_selects_hardware_concurrency) {
+    const solo::threading::ThreadPool pool(0);
+    EXPECT_GE(pool.GetThreadCount(), 1u);
+}
+
+TEST(thread_pool_test, visits_every_index_once) {
+    solo::threading::ThreadPool pool(4);
+    EXPECT_EQ(4u, pool.GetThreadCount());
+
+    constexpr std::size_t count = 100003;
+    std::vector<std::atomic<int>> visits(count);
+
+    pool.ParallelFor(count, 97, [&visits](std::size_t begin, std::size_t end) {
+        EXPECT_LE(end - begin, 97u);
+        for (std::size_t i = begin; i < end; ++i) {
+            visits[i].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    for (std::size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(1, visits[i].load()) << "index " << i;
+    }
+}
+
+TEST(thread_pool_test, balances_uneven_chunks) {
+    solo::threading::ThreadPool pool(3);
+    std::atomic<std::size_t> total{0};
+
+    // The first chunks are far more expensive than the rest, so completing
+    // relies on the other participants stealing from the first queue.
+    pool.ParallelFor(64, 1, [&total](std::size_t begin, std::size_t end) {
+        if (begin < 4) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        total.fetch_add(end - begin, std::memory_order_relaxed);
+    });
+
+    EXPECT_EQ(64u, total.load());
+}
+
+TEST(thread_pool_test, reusable_across_jobs) {
+    solo::threading::ThreadPool pool(4);
+    std::vector<double> values(5000, 1.0);
+
+    for (int job = 0; job < 200; ++job) {
+        pool.ParallelFor(values.size(), 64,
+                         [&values](std::size_t begin, std::size_t end) {
+                             for (std::size_t i = begin; i < end; ++i) {
+                                 values[i] += 1.0;
+                             }
+                         });
+    }
+
+    for (const double value : values) {
+        ASSERT_DOUBLE_EQ(201.0, value);
+    }
+}
+
+TEST(thread_pool_test, single_thread_runs_inline) {
+    solo::threading::ThreadPool pool(1);
+    const std::thread::id caller = std::this_thread::get_id();
+    std::size_t total = 0;
+
+    pool.ParallelFor(10, 3, [&](std::size_t begin, std::size_t end) {
+        EXPECT_EQ(caller, std::this_thread::get_id());
+        total += end - begin;
+    });
+
+    EXPECT_EQ(10u, total);
+}
+
+}  // namespace